@@ -0,0 +1,26 @@
+/**
+ * @file AllocationCounter.hpp
+ * @brief Replaces the global operator new to count heap allocations per thread.
+ *
+ * Include from exactly one translation unit of a benchmark executable.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace AllocationCounter {
+inline thread_local std::size_t allocations = 0;  ///< Allocations made by this thread.
+/**
+ * @brief Gets the number of allocations made by the calling thread so far.
+ */
+inline std::size_t get() { return allocations; }
+}  // namespace AllocationCounter
+
+void *operator new(std::size_t size) {
+    AllocationCounter::allocations++;
+    if (void *memory = std::malloc(size != 0 ? size : 1)) return memory;
+    throw std::bad_alloc();
+}
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
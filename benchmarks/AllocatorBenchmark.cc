@@ -0,0 +1,100 @@
+// Compares the default allocator with ObjectPool for short-lived projectiles
+// and with FrameArena for per-frame scratch lists, at rising fire rates.
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "AllocationCounter.hpp"
+#include "Utility/FrameArena.hpp"
+#include "Utility/ObjectPool.hpp"
+
+namespace {
+constexpr int FRAMES = 2000;
+constexpr int LIFETIME = 30; ///< Frames a projectile lives.
+
+struct Projectile {
+    float x = 0.f, y = 0.f, vx = 3.f, vy = 1.f;
+    float damage = 10.f;
+    std::uint32_t target = 0;
+};
+
+struct Result {
+    double nsPerFrame;
+    double allocationsPerFrame;
+};
+
+template <typename Function>
+Result measure(Function &&function) {
+    const std::size_t allocationsBefore = AllocationCounter::get();
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; frame++) function(frame);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return {std::chrono::duration<double, std::nano>(elapsed).count() / FRAMES,
+            static_cast<double>(AllocationCounter::get() - allocationsBefore) / FRAMES};
+}
+}  // namespace
+
+int main() {
+    volatile float sink = 0.f;
+    for (int firedPerFrame = 16; firedPerFrame <= 1024; firedPerFrame *= 4) {
+        const int live = firedPerFrame * LIFETIME;
+
+        // Projectiles expire in firing order, so both versions keep a ring of live ones
+        std::vector<std::unique_ptr<Projectile>> heapRing(live);
+        Result heap = measure([&](int frame) {
+            for (int shot = 0; shot < firedPerFrame; shot++) {
+                auto &slot = heapRing[(frame * firedPerFrame + shot) % live];
+                slot = std::make_unique<Projectile>();
+                slot->target = static_cast<std::uint32_t>(shot);
+            }
+            sink = sink + heapRing[frame % live]->damage;
+        });
+
+        ObjectPool<Projectile> pool(static_cast<std::uint32_t>(live));
+        std::vector<PoolHandle<Projectile>> poolRing(live);
+        Result pooled = measure([&](int frame) {
+            for (int shot = 0; shot < firedPerFrame; shot++) {
+                auto &slot = poolRing[(frame * firedPerFrame + shot) % live];
+                pool.destroy(slot);
+                slot = pool.create();
+                pool.get(slot)->target = static_cast<std::uint32_t>(shot);
+            }
+            sink = sink + pool.get(poolRing[frame % live])->damage;
+        });
+
+        std::printf(
+            "{\"benchmark\":\"projectile_pool\",\"fired_per_frame\":%d,\"heap_ns_per_frame\":%.1f,"
+            "\"heap_allocations_per_frame\":%.1f,\"pool_ns_per_frame\":%.1f,\"pool_allocations_per_frame\":%.1f,"
+            "\"pool_high_water\":%u}\n",
+            firedPerFrame, heap.nsPerFrame, heap.allocationsPerFrame, pooled.nsPerFrame,
+            pooled.allocationsPerFrame, pool.getHighWater());
+
+        // Scratch: each frame builds a hit list per shot, as collision queries would
+        Result scratchHeap = measure([&](int) {
+            for (int shot = 0; shot < firedPerFrame; shot++) {
+                std::vector<std::uint32_t> hits;
+                for (std::uint32_t hit = 0; hit < 8; hit++) hits.push_back(hit);
+                sink = sink + static_cast<float>(hits.size());
+            }
+        });
+        FrameArena arena(1024 * 1024);
+        Result scratchArena = measure([&](int) {
+            for (int shot = 0; shot < firedPerFrame; shot++) {
+                std::pmr::vector<std::uint32_t> hits(&arena);
+                for (std::uint32_t hit = 0; hit < 8; hit++) hits.push_back(hit);
+                sink = sink + static_cast<float>(hits.size());
+            }
+            arena.reset();
+        });
+
+        std::printf(
+            "{\"benchmark\":\"frame_scratch\",\"lists_per_frame\":%d,\"heap_ns_per_frame\":%.1f,"
+            "\"heap_allocations_per_frame\":%.1f,\"arena_ns_per_frame\":%.1f,\"arena_allocations_per_frame\":%.1f,"
+            "\"arena_high_water_bytes\":%zu}\n",
+            firedPerFrame, scratchHeap.nsPerFrame, scratchHeap.allocationsPerFrame, scratchArena.nsPerFrame,
+            scratchArena.allocationsPerFrame, arena.getHighWater());
+    }
+}
@@ -0,0 +1,64 @@
+// Compares updating entities through per-object virtual calls with the
+// EntityStore movement system.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Core/EntityStore.hpp"
+
+namespace {
+constexpr int ENTITIES = 10000;
+constexpr int TICKS = 1000;
+
+// Stand-in for a GameObject subclass: heap allocated, updated through a vtable.
+class MovingObject {
+   public:
+    virtual ~MovingObject() = default;
+    virtual void update() { position += velocity; }
+    sf::Vector2f position;
+    sf::Vector2f velocity{1.f, 0.5f};
+    float health = 100.f;
+};
+
+template <typename Function>
+void measure(const char *name, Function &&function) {
+    auto start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < TICKS; tick++) function();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    double nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count();
+    std::printf("{\"benchmark\":\"%s\",\"entities\":%d,\"ticks\":%d,\"ns_per_entity\":%.3f}\n",
+                name, ENTITIES, TICKS, nanoseconds / TICKS / ENTITIES);
+}
+}  // namespace
+
+int main() {
+    // Interleave other allocations and shuffle, as creating and destroying
+    // entities over a game would, so the objects are not contiguous by luck.
+    std::vector<std::unique_ptr<MovingObject>> objects;
+    std::vector<std::unique_ptr<char[]>> otherAllocations;
+    std::mt19937 random(42);
+    for (int index = 0; index < ENTITIES; index++) {
+        objects.push_back(std::make_unique<MovingObject>());
+        otherAllocations.push_back(std::make_unique<char[]>(16 + random() % 256));
+    }
+    std::shuffle(objects.begin(), objects.end(), random);
+    measure("virtual_objects", [&]() {
+        for (auto &object : objects) object->update();
+    });
+
+    EntityStore store;
+    store.reserve(ENTITIES);
+    for (int index = 0; index < ENTITIES; index++) {
+        Entity entity = store.create(Component::Position | Component::Velocity | Component::Health);
+        store.velocity(entity) = {1.f, 0.5f};
+    }
+    measure("entity_store", [&]() { store.integrate(); });
+
+    float checksum = 0.f;
+    for (auto &object : objects) checksum += object->position.x;
+    for (sf::Vector2f position : store.getPositions()) checksum += position.x;
+    std::fprintf(stderr, "checksum %f\n", checksum);
+}
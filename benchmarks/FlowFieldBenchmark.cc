@@ -0,0 +1,78 @@
+// Times a full flow-field solve on a 256x256 map against incremental repairs
+// for tower placement and removal, the worker's edit-to-publish latency, and
+// 10k enemies steering by one direction lookup each.
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Map/FlowField.hpp"
+
+namespace {
+constexpr int MAP_SIZE = 256;
+constexpr int AGENTS = 10000;
+constexpr int EDITS = 200;
+constexpr int TICKS = 100;
+constexpr float CELL_SIZE = 32.f;
+
+double microsecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+int main() {
+    std::mt19937 random(1234);
+    std::uniform_int_distribution<int> coordinate(1, MAP_SIZE - 2);
+    MapGrid grid({MAP_SIZE, MAP_SIZE}, CELL_SIZE);
+    // Scatter some rough terrain and walls so routes are not straight lines
+    for (int wall = 0; wall < 2000; wall++) grid.setCost({coordinate(random), coordinate(random)}, MapGrid::BLOCKED);
+    for (int rough = 0; rough < 4000; rough++) grid.setCost({coordinate(random), coordinate(random)}, 3);
+    const std::vector<sf::Vector2i> goals{{MAP_SIZE / 2, MAP_SIZE / 2}};
+    grid.setCost(goals.front(), 1);
+
+    auto start = std::chrono::steady_clock::now();
+    FlowField field(grid, goals, false);
+    const double fullUs = microsecondsSince(start);
+
+    std::vector<sf::Vector2i> towers;
+    for (int edit = 0; edit < EDITS; edit++) {
+        sf::Vector2i cell{coordinate(random), coordinate(random)};
+        if (cell != goals.front()) towers.push_back(cell);
+    }
+    start = std::chrono::steady_clock::now();
+    for (sf::Vector2i tower : towers) field.setCost(tower, MapGrid::BLOCKED);
+    const double placeUs = microsecondsSince(start) / towers.size();
+    start = std::chrono::steady_clock::now();
+    for (sf::Vector2i tower : towers) field.setCost(tower, 1);
+    const double removeUs = microsecondsSince(start) / towers.size();
+
+    std::printf(
+        "{\"benchmark\":\"flow_field_repair\",\"map\":%d,\"full_solve_us\":%.1f,\"place_tower_us\":%.1f,"
+        "\"remove_tower_us\":%.1f}\n",
+        MAP_SIZE, fullUs, placeUs, removeUs);
+
+    FlowField threaded(grid, goals);
+    double latencyUs = 0.0;
+    for (sf::Vector2i tower : towers) {
+        start = std::chrono::steady_clock::now();
+        threaded.setCost(tower, MapGrid::BLOCKED);
+        threaded.waitForUpdates();
+        latencyUs += microsecondsSince(start);
+    }
+    std::printf("{\"benchmark\":\"flow_field_worker\",\"map\":%d,\"edit_to_publish_us\":%.1f}\n", MAP_SIZE,
+                latencyUs / towers.size());
+
+    std::uniform_real_distribution<float> position(0.f, MAP_SIZE * CELL_SIZE);
+    std::vector<sf::Vector2f> agents;
+    for (int agent = 0; agent < AGENTS; agent++) agents.push_back({position(random), position(random)});
+    start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < TICKS; tick++) {
+        // One snapshot per tick, as the game would do
+        auto snapshot = threaded.getSnapshot();
+        for (sf::Vector2f &agent : agents) agent += snapshot->getDirectionAt(agent) * 2.f;
+    }
+    const double steerNs = microsecondsSince(start) * 1000.0 / (static_cast<double>(AGENTS) * TICKS);
+    std::printf("{\"benchmark\":\"flow_field_agents\",\"map\":%d,\"agents\":%d,\"steer_ns_per_agent\":%.2f}\n",
+                MAP_SIZE, AGENTS, steerNs);
+}
@@ -0,0 +1,128 @@
+// Runs one tick's update as a task graph (movement, spatial index rebuild,
+// targeting, projectile resolution) on 1 to N threads and reports the
+// speed-up over a single thread.
+//
+// Usage: JobBenchmark [maxThreads]
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Base/Constants.hpp"
+#include "Core/EntityStore.hpp"
+#include "Core/JobSystem.hpp"
+#include "Utility/SpatialHash.hpp"
+
+namespace {
+constexpr int ENEMIES = 20000;
+constexpr int TOWERS = 400;
+constexpr float RANGE = 150.f;
+constexpr int TICKS = 200;
+
+/**
+ * @brief A self-contained tick of a busy wave, built on a given job system.
+ */
+struct Wave {
+    EntityStore enemies;
+    SpatialHash index{SpatialHash::suggestCellSize(GameConstants::WINDOW_WIDTH * GameConstants::WINDOW_HEIGHT,
+                                                   ENEMIES)};
+    std::vector<sf::Vector2f> towers;
+    std::vector<std::uint32_t> targets;
+    std::vector<float> damage;
+    TaskGraph graph;
+
+    Wave(JobSystem &jobs, std::mt19937 &random) {
+        std::uniform_real_distribution<float> x(0.f, GameConstants::WINDOW_WIDTH);
+        std::uniform_real_distribution<float> y(0.f, GameConstants::WINDOW_HEIGHT);
+        std::uniform_real_distribution<float> speed(-1.f, 1.f);
+        enemies.reserve(ENEMIES);
+        for (int enemy = 0; enemy < ENEMIES; enemy++) {
+            Entity entity = enemies.create(Component::Position | Component::Velocity | Component::Health);
+            enemies.position(entity) = {x(random), y(random)};
+            enemies.velocity(entity) = {speed(random), speed(random)};
+        }
+        for (int tower = 0; tower < TOWERS; tower++) towers.push_back({x(random), y(random)});
+        targets.resize(TOWERS);
+        damage.resize(ENEMIES);
+
+        auto movement = graph.add([this, &jobs]() {
+            auto positions = enemies.getPositions();
+            auto velocities = enemies.getVelocities();
+            jobs.parallelFor(0, positions.size(), 1024, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t row = begin; row < end; row++) {
+                    sf::Vector2f &position = positions[row];
+                    position += velocities[row];
+                    if (position.x < 0.f || position.x > GameConstants::WINDOW_WIDTH) velocities[row].x *= -1.f;
+                    if (position.y < 0.f || position.y > GameConstants::WINDOW_HEIGHT) velocities[row].y *= -1.f;
+                }
+            });
+        });
+        // SpatialHash is not thread-safe, so the rebuild is the serial stage
+        auto rebuild = graph.add([this]() {
+            auto positions = enemies.getPositions();
+            for (std::uint32_t row = 0; row < positions.size(); row++) index.update(row, positions[row]);
+        });
+        auto targeting = graph.add([this, &jobs]() {
+            auto positions = enemies.getPositions();
+            jobs.parallelFor(0, towers.size(), 8, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t tower = begin; tower < end; tower++) {
+                    float best = RANGE * RANGE;
+                    std::uint32_t target = UINT32_MAX;
+                    for (std::uint32_t row = 0; row < positions.size(); row++) {
+                        sf::Vector2f offset = positions[row] - towers[tower];
+                        float distance = offset.x * offset.x + offset.y * offset.y;
+                        if (distance < best) {
+                            best = distance;
+                            target = row;
+                        }
+                    }
+                    targets[tower] = target;
+                }
+            });
+        });
+        auto resolution = graph.add([this, &jobs]() {
+            std::fill(damage.begin(), damage.end(), 0.f);
+            for (std::uint32_t target : targets)
+                if (target != UINT32_MAX) damage[target] += 1.f;
+            auto healths = enemies.getHealths();
+            jobs.parallelFor(0, healths.size(), 2048, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t row = begin; row < end; row++)
+                    healths[row].current = std::max(1.f, healths[row].current - damage[row]);
+            });
+        });
+        graph.precede(movement, rebuild);
+        graph.precede(movement, targeting);
+        graph.precede(rebuild, resolution);
+        graph.precede(targeting, resolution);
+    }
+};
+}  // namespace
+
+int main(int argc, char **argv) {
+    std::size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    if (argc > 1) maxThreads = std::max<std::size_t>(1, std::strtoul(argv[1], nullptr, 10));
+
+    double singleThreadMs = 0.0;
+    for (std::size_t threads = 1; threads <= maxThreads; threads++) {
+        JobSystem jobs(threads - 1);
+        std::mt19937 random(99);
+        Wave wave(jobs, random);
+        wave.graph.run(jobs);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int tick = 0; tick < TICKS; tick++) wave.graph.run(jobs);
+        double tickMs =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / TICKS;
+        if (threads == 1) singleThreadMs = tickMs;
+
+        std::printf(
+            "{\"benchmark\":\"job_system_tick\",\"threads\":%zu,\"enemies\":%d,\"towers\":%d,\"tick_ms\":%.3f,"
+            "\"speedup\":%.2f,\"steals\":%llu}\n",
+            threads, ENEMIES, TOWERS, tickMs, singleThreadMs / tickMs,
+            static_cast<unsigned long long>(jobs.getStealCount()));
+    }
+}
@@ -0,0 +1,64 @@
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include "AllocationCounter.hpp"
+#include "Utility/logger.hpp"
+
+namespace {
+constexpr int CALLS = 100000;
+
+// The substr/to_string formatter Logger::logf used before, kept for comparison.
+template <typename T>
+void legacyFormat(std::ostringstream &oss, const std::string &format, T &&value) {
+    size_t pos = format.find("{}");
+    if (pos != std::string::npos)
+        oss << format.substr(0, pos) << value << format.substr(pos + 2);
+    else
+        oss << format;
+}
+template <typename T, typename... Args>
+void legacyFormat(std::ostringstream &oss, const std::string &format, T &&value, Args... args) {
+    size_t pos = format.find("{}");
+    if (pos != std::string::npos) {
+        std::string newFormat = format.substr(0, pos) + std::to_string(value) + format.substr(pos + 2);
+        legacyFormat(oss, newFormat, args...);
+    } else {
+        oss << format;
+    }
+}
+
+template <typename Function>
+void measure(const char *name, Function &&function) {
+    std::size_t allocationsBefore = AllocationCounter::get();
+    auto start = std::chrono::steady_clock::now();
+    for (int call = 0; call < CALLS; call++) function(call);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    double nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count();
+    std::printf(
+        "{\"benchmark\":\"%s\",\"calls\":%d,\"ns_per_call\":%.1f,"
+        "\"allocations_per_call\":%.3f}\n",
+        name, CALLS, nanoseconds / CALLS,
+        static_cast<double>(AllocationCounter::get() - allocationsBefore) / CALLS);
+}
+}  // namespace
+
+int main() {
+    // Keep I/O out of the measurement: records go to a backend with no sinks.
+    AsyncLogConfig config;
+    config.writeToConsole = false;
+    Logger::startAsync(config);
+
+    measure("legacy_logf", [](int call) {
+        std::ostringstream oss;
+        legacyFormat(oss, "Tower {} hit enemy {} for {} damage", call, call * 7, 12.5f);
+        Logger::log(LogLevel::INFO, oss.str());
+    });
+    measure("logf", [](int call) {
+        Logger::logf(LogLevel::INFO, "Tower {} hit enemy {} at {} for {} damage", call,
+                     call * 7, sf::Vector2f{64.f, 32.f}, 12.5f);
+    });
+
+    Logger::stopAsync();
+}
@@ -0,0 +1,90 @@
+// Sweeps a placement preview across a 256x256 map while towers go down, and
+// compares the cached articulation lookup with a BFS per hovered tile.
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+
+#include "Map/PlacementValidator.hpp"
+
+namespace {
+constexpr int MAP_SIZE = 256;
+constexpr int TOWERS = 500;
+constexpr int HOVERS_PER_TOWER = 200;
+constexpr int BFS_HOVERS = 50;
+
+double microsecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief The naive answer: block the tile and search from the goal for the spawn.
+ */
+bool bfsCanPlace(MapGrid &grid, sf::Vector2i spawn, sf::Vector2i goal, sf::Vector2i cell,
+                 std::vector<std::uint8_t> &seen) {
+    if (grid.isBlocked(cell)) return false;
+    grid.setCost(cell, MapGrid::BLOCKED);
+    std::fill(seen.begin(), seen.end(), 0);
+    std::deque<sf::Vector2i> queue{goal};
+    seen[grid.index(goal)] = 1;
+    bool found = false;
+    while (!queue.empty() && !found) {
+        sf::Vector2i current = queue.front();
+        queue.pop_front();
+        for (sf::Vector2i step : {sf::Vector2i{1, 0}, sf::Vector2i{-1, 0}, sf::Vector2i{0, 1}, sf::Vector2i{0, -1}}) {
+            sf::Vector2i next = current + step;
+            if (grid.isBlocked(next) || seen[grid.index(next)]) continue;
+            seen[grid.index(next)] = 1;
+            found = found || next == spawn;
+            queue.push_back(next);
+        }
+    }
+    grid.setCost(cell, 1);
+    return found;
+}
+}  // namespace
+
+int main() {
+    std::mt19937 random(1234);
+    std::uniform_int_distribution<int> coordinate(0, MAP_SIZE - 1);
+    const sf::Vector2i spawn{0, 0}, goal{MAP_SIZE - 1, MAP_SIZE - 1};
+    MapGrid grid({MAP_SIZE, MAP_SIZE});
+    PlacementValidator validator(grid, {spawn}, {goal});
+
+    double placeUs = 0.0, rebuildUs = 0.0, hoverUs = 0.0;
+    volatile int sink = 0;
+    for (int tower = 0; tower < TOWERS; tower++) {
+        // The first hover after a placement pays for the rebuild
+        auto start = std::chrono::steady_clock::now();
+        sink = sink + validator.canPlace({coordinate(random), coordinate(random)});
+        rebuildUs += microsecondsSince(start);
+        start = std::chrono::steady_clock::now();
+        for (int hover = 1; hover < HOVERS_PER_TOWER; hover++)
+            sink = sink + validator.canPlace({coordinate(random), coordinate(random)});
+        hoverUs += microsecondsSince(start);
+
+        const sf::Vector2i cell{coordinate(random), coordinate(random)};
+        start = std::chrono::steady_clock::now();
+        if (validator.canPlace(cell)) {
+            validator.setCost(cell, MapGrid::BLOCKED);
+            grid.setCost(cell, MapGrid::BLOCKED);
+        }
+        placeUs += microsecondsSince(start);
+    }
+
+    std::vector<std::uint8_t> seen(grid.getCosts().size());
+    auto start = std::chrono::steady_clock::now();
+    for (int hover = 0; hover < BFS_HOVERS; hover++)
+        sink = sink + bfsCanPlace(grid, spawn, goal, {coordinate(random), coordinate(random)}, seen);
+    const double bfsUs = microsecondsSince(start) / BFS_HOVERS;
+
+    std::printf(
+        "{\"benchmark\":\"placement_preview\",\"map\":%d,\"towers\":%d,\"rebuilds\":%u,"
+        "\"rebuild_us\":%.1f,\"cached_hover_us\":%.3f,\"bfs_hover_us\":%.1f,\"place_us\":%.3f}\n",
+        MAP_SIZE, TOWERS, validator.getRebuildCount(), rebuildUs / TOWERS,
+        hoverUs / (TOWERS * (HOVERS_PER_TOWER - 1)), bfsUs, placeUs / TOWERS);
+    (void)sink;
+}
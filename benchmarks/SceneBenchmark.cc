@@ -0,0 +1,93 @@
+// Runs a scene headless for a fixed number of ticks and prints one JSON line.
+//
+// Usage: SceneBenchmark [--scene Blank] [--ticks 600] [--script input.txt]
+//                       [--replay session.inpr] [--no-render] [--null-target]
+//
+// --replay runs a session recorded by the game with --record, for as many ticks
+// as it lasted unless --ticks is given, as fast as the scene allows.
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "AllocationCounter.hpp"
+#include "Base/Constants.hpp"
+#include "Core/HeadlessRunner.hpp"
+#include "Scene/BlankScene.hpp"
+#include "Utility/logger.hpp"
+
+int main(int argc, char **argv) {
+    HeadlessOptions options;
+    options.countAllocations = AllocationCounter::get;
+    std::string sceneName = "Blank";
+    std::string scriptPath;
+    std::string replayPath;
+    bool ticksGiven = false;
+    for (int index = 1; index < argc; index++) {
+        std::string argument = argv[index];
+        bool hasValue = index + 1 < argc;
+        if (argument == "--ticks" && hasValue) {
+            options.ticks = static_cast<std::uint32_t>(std::strtoul(argv[++index], nullptr, 10));
+            ticksGiven = true;
+        } else if (argument == "--script" && hasValue)
+            scriptPath = argv[++index];
+        else if (argument == "--replay" && hasValue)
+            replayPath = argv[++index];
+        else if (argument == "--scene" && hasValue)
+            sceneName = argv[++index];
+        else if (argument == "--no-render")
+            options.render = false;
+        else if (argument == "--null-target")
+            options.useRenderTexture = false;
+        else {
+            std::fprintf(stderr, "Unknown argument: %s\n", argument.c_str());
+            return 2;
+        }
+    }
+
+    // Keep the console clean for the JSON output.
+    AsyncLogConfig config;
+    config.writeToConsole = false;
+    Logger::startAsync(config);
+
+    std::vector<ScriptedEvent> script;
+    if (!scriptPath.empty()) {
+        std::ifstream file(scriptPath);
+        if (!file) {
+            std::fprintf(stderr, "Cannot open script: %s\n", scriptPath.c_str());
+            Logger::stopAsync();
+            return 1;
+        }
+        script = HeadlessRunner::parseScript(file);
+    }
+    if (!replayPath.empty()) {
+        auto recording = InputRecorder::load(replayPath);
+        if (!recording) {
+            std::fprintf(stderr, "Cannot load recording: %s\n", replayPath.c_str());
+            Logger::stopAsync();
+            return 1;
+        }
+        const auto tickRate = static_cast<std::uint32_t>(std::lround(1.f / GameConstants::TICK_INTERVAL));
+        if (recording->tickRate != tickRate)
+            std::fprintf(stderr, "Recording ran at %u ticks per second, this build at %u\n",
+                         recording->tickRate, tickRate);
+        if (!ticksGiven) options.ticks = recording->ticks;
+        script = std::move(recording->events);
+    }
+
+    HeadlessRunner runner(options);
+    SceneManager &sceneManager = runner.getSceneManager();
+    sceneManager.registerScene<BlankScene>("Blank");
+    sceneManager.changeScene(sceneName);
+    if (sceneManager.getCurrentScene() == nullptr) {
+        std::fprintf(stderr, "Unknown scene: %s\n", sceneName.c_str());
+        Logger::stopAsync();
+        return 1;
+    }
+
+    std::printf("%s\n", runner.run(script).toJson().c_str());
+    Logger::stopAsync();
+    return 0;
+}
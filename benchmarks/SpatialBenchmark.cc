@@ -0,0 +1,78 @@
+// Sweeps the enemy count on a fixed-size map and compares tower target
+// acquisition by linear scan with SpatialHash queries.
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Base/Constants.hpp"
+#include "Utility/SpatialHash.hpp"
+
+namespace {
+constexpr int TOWERS = 200;
+constexpr float RANGE = 120.f;
+constexpr int REPEATS = 20;
+
+template <typename Function>
+double nanosecondsPerCall(int calls, Function &&function) {
+    auto start = std::chrono::steady_clock::now();
+    for (int repeat = 0; repeat < REPEATS; repeat++)
+        for (int call = 0; call < calls; call++) function(call);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / (calls * REPEATS);
+}
+}  // namespace
+
+int main() {
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> x(0.f, GameConstants::WINDOW_WIDTH);
+    std::uniform_real_distribution<float> y(0.f, GameConstants::WINDOW_HEIGHT);
+    std::vector<sf::Vector2f> towers;
+    for (int tower = 0; tower < TOWERS; tower++) towers.push_back({x(random), y(random)});
+
+    for (int enemies = 250; enemies <= 64000; enemies *= 2) {
+        std::vector<sf::Vector2f> positions;
+        for (int enemy = 0; enemy < enemies; enemy++) positions.push_back({x(random), y(random)});
+
+        SpatialHash hash(SpatialHash::suggestCellSize(
+            GameConstants::WINDOW_WIDTH * GameConstants::WINDOW_HEIGHT, enemies));
+        double updateNs = nanosecondsPerCall(enemies, [&](int enemy) {
+            sf::Vector2f &position = positions[enemy];
+            position.x += 0.5f;
+            if (position.x > GameConstants::WINDOW_WIDTH) position.x = 0.f;
+            hash.update(static_cast<std::uint32_t>(enemy), position);
+        });
+
+        volatile std::uint32_t sink = 0;
+        double linearNs = nanosecondsPerCall(TOWERS, [&](int tower) {
+            float bestDistance = RANGE * RANGE;
+            std::uint32_t best = UINT32_MAX;
+            for (std::uint32_t enemy = 0; enemy < positions.size(); enemy++) {
+                sf::Vector2f offset = positions[enemy] - towers[tower];
+                float distance = offset.x * offset.x + offset.y * offset.y;
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    best = enemy;
+                }
+            }
+            sink = best;
+        });
+
+        std::vector<std::uint32_t> result;
+        double nearestNs = nanosecondsPerCall(TOWERS, [&](int tower) {
+            hash.queryNearest(towers[tower], 1, RANGE, result);
+            sink = result.empty() ? UINT32_MAX : result.front();
+        });
+        double hitNs = nanosecondsPerCall(TOWERS, [&](int tower) {
+            hash.queryRect({towers[tower], {8.f, 8.f}}, result);
+            sink = static_cast<std::uint32_t>(result.size());
+        });
+
+        std::printf(
+            "{\"benchmark\":\"spatial_hash\",\"enemies\":%d,\"cell_size\":%.1f,\"update_ns_per_enemy\":%.1f,"
+            "\"linear_target_ns\":%.1f,\"nearest_target_ns\":%.1f,\"projectile_hit_ns\":%.1f}\n",
+            enemies, hash.getCellSize(), updateNs, linearNs, nearestNs, hitNs);
+        (void)sink;
+    }
+}
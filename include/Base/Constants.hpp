@@ -3,6 +3,7 @@
  * @brief Contains global game constants such as window size, title, and timing intervals.
  */
 #pragma once
+#include <cstddef>
 /**
  * @namespace GameConstants
  * @brief Namespace for storing game-wide constant values.
@@ -14,5 +15,15 @@ namespace GameConstants {
 
     constexpr float TICK_INTERVAL = 1.f / 60;
     constexpr float SUBTICK_INTERVAL = 1.f / 60 / 8;
+    constexpr int SUBTICKS_PER_TICK = static_cast<int>(TICK_INTERVAL / SUBTICK_INTERVAL + 0.5f);
+    constexpr int MAX_TICKS_PER_FRAME = 5; ///< Catch-up cap; time beyond this is dropped.
     constexpr int TARGET_FPS = 60;
-}
\ No newline at end of file
+    constexpr std::size_t MAX_VOICES = 32; ///< Sounds that can play at the same time.
+    constexpr std::size_t MUSIC_MEMORY_CAP_BYTES = 256 * 1024; ///< Decode buffers of streamed music.
+    constexpr int MUSIC_CROSSFADE_MS = 1500; ///< Crossfade between the music of two scenes.
+    constexpr int UPLOAD_BUDGET_MS = 2; ///< Main-thread time per frame for finishing background asset loads.
+    constexpr std::size_t INPUT_QUEUE_CAPACITY = 1024; ///< Events buffered between the main and simulation threads.
+    constexpr std::size_t FRAME_ARENA_BYTES = 1024 * 1024; ///< Per-frame scratch memory of scenes.
+    constexpr std::size_t SCENE_MEMORY_BUDGET_BYTES = 64 * 1024 * 1024; ///< Inactive scenes are evicted beyond this.
+    constexpr const char* ASSET_PACK = "assets.pack"; ///< Archive built from assets/, beside the executable; loose files are used without it.
+}
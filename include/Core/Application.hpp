@@ -4,30 +4,92 @@
  */
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <atomic>
+#include <optional>
+#include <shared_mutex>
+#include <string>
 
+#include "Core/FixedTimestep.hpp"
 #include "Core/SceneManager.hpp"
 #include "Core/ResourceManager.hpp"
 #include "Core/InputManager.hpp"
+#include "Core/InputRecorder.hpp"
+#include "Core/JobSystem.hpp"
+#include "Core/RenderSnapshot.hpp"
 #include "TestMockClasses/SoundClickTrigger.hpp"
+#include "Utility/FrameArena.hpp"
+#include "Utility/MpscQueue.hpp"
+#include "Utility/TripleBuffer.hpp"
+/**
+ * @struct ApplicationOptions
+ * @brief Command line settings of the game.
+ */
+struct ApplicationOptions {
+    bool threaded = false;  ///< Run simulation and rendering on their own threads.
+    std::string recordPath; ///< File to record input into for replay; empty to not record.
+};
 /**
  * @class Application
  * @brief Main application class that manages the game loop and core systems.
+ *
+ * By default one thread polls events, runs the fixed ticks and renders. In
+ * threaded mode the main thread only polls events and forwards them through
+ * a lock-free queue; a simulation thread runs the ticks and publishes a
+ * RenderSnapshot per tick into a triple buffer, and a render thread draws
+ * the latest snapshot, so a heavy tick no longer delays display() and
+ * vsync waits no longer eat simulation time.
+ *
+ * In threaded mode the simulation thread owns the resource maps, as the
+ * main thread does otherwise, and the render thread reads textures and fonts
+ * under resourceMutex. The resource manager holds it exclusively only while
+ * it adds or removes one of them, so scenes may load and unload assets from
+ * any hook and the render thread waits for that change, never for a tick.
  */
 class Application {
     private:
     sf::RenderWindow window; ///< The main game window.
-    SceneManager sceneManager; ///< Manages game scenes.
     ResourceManager resourceManager; ///< Manages resources (textures, sounds, etc.).
     InputManager inputManager; ///< Handles input events.
     SoundClickTrigger testTrigger; ///< Test trigger for sound on click.
-    bool isRunning; ///< Indicates if the application is running.
+    std::atomic<bool> isRunning; ///< Indicates if the application is running.
+    FixedTimestep timestep; ///< Converts frame time into fixed simulation ticks.
+    FrameArena frameArena; ///< Scratch memory of scenes, reset after every frame.
+    JobSystem jobSystem; ///< Worker threads scenes submit update jobs to.
+    SceneManager sceneManager; ///< Manages game scenes; declared after the services in their context, so scenes are destroyed first.
+    bool threaded; ///< Whether simulation and rendering run on their own threads.
+    InputRecorder inputRecorder; ///< Records input for replay when a record path was given.
+    MpscQueue<std::optional<sf::Event>> eventQueue; ///< Events from the main thread to the simulation thread.
+    TripleBuffer<RenderSnapshot> snapshots; ///< Snapshots from the simulation thread to the render thread.
+    std::shared_mutex resourceMutex; ///< Held shared while drawing; see ResourceManager::setDrawMutex().
+
+    /**
+     * @brief Runs the single-threaded loop.
+     */
+    void runSingleThreaded();
+    /**
+     * @brief Polls events on the main thread while the simulation and render threads run.
+     */
+    void runThreaded();
+    /**
+     * @brief Simulation thread of threaded mode: input, ticks and snapshots.
+     */
+    void simulationLoop();
+    /**
+     * @brief Render thread of threaded mode: draws the latest snapshot.
+     */
+    void renderLoop();
+    /**
+     * @brief Passes an event to the recorder, input manager and scenes, before the next tick.
+     */
+    void dispatchEvent(std::optional<sf::Event> &event);
     public:
     /**
      * @brief Constructs the Application and initializes core systems.
+     * @param options Loop and recording settings.
      */
-    Application();
+    explicit Application(const ApplicationOptions &options = {});
     /**
-     * @brief Runs the main game loop.
+     * @brief Runs the main game loop until the window closes.
      */
     void run();
     /**
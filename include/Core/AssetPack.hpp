@@ -0,0 +1,103 @@
+/**
+ * @file AssetPack.hpp
+ * @brief Declares AssetPack, a read-only archive of asset files served from a memory mapping.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Utility/MappedFile.hpp"
+#include "Utility/StringId.hpp"
+
+/**
+ * @class AssetPack
+ * @brief Looks up files of a pack archive by name and returns views into the mapped archive.
+ *
+ * Layout, all integers little endian:
+ * @code
+ * char[4]  magic "APAK"
+ * u32      version (1)
+ * u32      entry count
+ * u32      name table size
+ * entry[]  u64 StringId of the name, u64 offset, u64 size, u32 name offset, u32 name length;
+ *          sorted by StringId
+ * char[]   name table
+ * blobs    each starting at a multiple of ALIGNMENT
+ * @endcode
+ *
+ * Opening a pack maps it and checks the table of contents; file contents are
+ * only read from disk when a returned view is first touched. Lookups are a
+ * binary search over the hashes followed by one name comparison.
+ */
+class AssetPack {
+   private:
+    MappedFile file;                    ///< The mapped archive.
+    const std::byte *entries = nullptr; ///< Start of the table of contents.
+    std::uint32_t entryCount = 0;       ///< Number of entries.
+    std::string_view names;             ///< Name table.
+
+   public:
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr std::size_t ALIGNMENT = 16;   ///< Alignment of every blob in the file.
+    static constexpr std::size_t HEADER_SIZE = 16; ///< Bytes before the table of contents.
+    static constexpr std::size_t ENTRY_SIZE = 32;  ///< Bytes per table of contents entry.
+
+    /**
+     * @struct Source
+     * @brief One file to write into a pack.
+     */
+    struct Source {
+        std::string name;             ///< Lookup name, e.g. "assets/sounds/pickupCoin.wav".
+        std::vector<std::byte> data;  ///< File contents.
+    };
+
+    /**
+     * @brief Maps a pack, closing any pack opened before.
+     * @return False if the file is missing or is not a valid pack.
+     */
+    bool open(const std::filesystem::path &path);
+
+    /**
+     * @brief Unmaps the pack; views returned by find() become invalid.
+     */
+    void close();
+
+    /**
+     * @brief Checks whether a pack is open.
+     */
+    bool isOpen() const { return file.isOpen(); }
+
+    /**
+     * @brief Gets the number of files in the pack.
+     */
+    std::size_t size() const { return entryCount; }
+
+    /**
+     * @brief Finds a file by name.
+     * @return View of its contents, valid while the pack stays open; empty if there is no such file.
+     */
+    std::span<const std::byte> find(std::string_view name) const;
+
+    /**
+     * @brief Finds a file by a path as the game spells it, e.g. "assets/./sounds/coin.wav".
+     * @return View of its contents, see find().
+     */
+    std::span<const std::byte> findPath(const std::filesystem::path &path) const;
+
+    /**
+     * @brief Checks whether the pack has a file.
+     */
+    bool contains(std::string_view name) const;
+
+    /**
+     * @brief Writes a pack.
+     * @return False if the stream failed or two names have the same StringId.
+     */
+    static bool write(std::ostream &out, std::vector<Source> sources);
+};
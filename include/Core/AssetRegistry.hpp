@@ -0,0 +1,182 @@
+/**
+ * @file AssetRegistry.hpp
+ * @brief Declares Handle and AssetRegistry, the generational storage behind ResourceManager.
+ */
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Utility/StringId.hpp"
+
+/**
+ * @struct Handle
+ * @brief Compact reference to an asset: a slot index plus the slot's generation.
+ *
+ * The tag type keeps handles of different asset kinds from being mixed up.
+ * Once the asset is unloaded, the slot's generation moves on and the handle
+ * resolves to nullptr instead of to whatever reuses the slot.
+ *
+ * @tparam Tag Empty type naming the asset kind.
+ */
+template <typename Tag>
+struct Handle {
+    static constexpr std::uint32_t INVALID = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t index = INVALID;  ///< Slot in the registry.
+    std::uint32_t generation = 0;   ///< Generation of the slot when the handle was issued.
+    /**
+     * @brief Checks whether the handle was ever issued; it may still be stale.
+     */
+    bool isValid() const { return index != INVALID; }
+    bool operator==(const Handle &) const = default;
+};
+
+struct TextureTag {};
+struct SoundTag {};
+struct FontTag {};
+struct SpriteTag {};
+using TextureHandle = Handle<TextureTag>; ///< Handle to a loaded sf::Texture.
+using SoundHandle = Handle<SoundTag>;     ///< Handle to a loaded sf::SoundBuffer.
+using FontHandle = Handle<FontTag>;       ///< Handle to a loaded sf::Font.
+using SpriteHandle = Handle<SpriteTag>;   ///< Handle to a sprite frame of a loaded atlas.
+
+/**
+ * @class AssetRegistry
+ * @brief Owns assets of one type in slots addressed by generational handles.
+ *
+ * Names are interned once, when an asset is added. Resolving a handle is a
+ * bounds check, a generation check and an array index; looking a name up by
+ * StringId is one hash-map probe. Lookups by plain string are kept for tools
+ * and also verify the stored name, so a hash collision is never mistaken for
+ * a match.
+ *
+ * @tparam T Asset type.
+ * @tparam Tag Tag type of the matching Handle.
+ */
+template <typename T, typename Tag>
+class AssetRegistry {
+   public:
+    using HandleType = Handle<Tag>;
+
+   private:
+    /**
+     * @brief One asset together with the data needed to validate handles.
+     */
+    struct Slot {
+        std::unique_ptr<T> asset;     ///< The asset, null when the slot is free.
+        std::uint32_t generation = 0; ///< Bumped whenever the slot is freed.
+        StringId id;                  ///< Hash of name.
+        std::string name;             ///< Name the asset was added under.
+    };
+
+    std::vector<Slot> slots;                                   ///< Slot storage.
+    std::vector<std::uint32_t> freeSlots;                      ///< Indices of free slots.
+    std::unordered_map<std::uint64_t, std::uint32_t> byName;   ///< StringId value to slot index.
+
+   public:
+    /**
+     * @brief Stores an asset under a name.
+     * @param name Name to intern; must not be in use already.
+     * @param asset Asset to take ownership of.
+     * @return Handle to the asset, or an invalid handle if the name (or its hash) is taken.
+     */
+    HandleType add(std::string_view name, std::unique_ptr<T> asset) {
+        StringId id = StringId::hash(name);
+        if (byName.find(id.value) != byName.end()) return {};
+        std::uint32_t index;
+        if (!freeSlots.empty()) {
+            index = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            index = static_cast<std::uint32_t>(slots.size());
+            slots.emplace_back();
+        }
+        slots[index].asset = std::move(asset);
+        slots[index].id = id;
+        slots[index].name = name;
+        byName.emplace(id.value, index);
+        return {index, slots[index].generation};
+    }
+
+    /**
+     * @brief Destroys an asset; every handle to it becomes stale.
+     * @return False if the handle was already stale.
+     */
+    bool remove(HandleType handle) {
+        if (get(handle) == nullptr) return false;
+        Slot &slot = slots[handle.index];
+        byName.erase(slot.id.value);
+        slot.asset.reset();
+        slot.name.clear();
+        slot.generation++;
+        freeSlots.push_back(handle.index);
+        return true;
+    }
+
+    /**
+     * @brief Destroys every asset.
+     */
+    void clear() {
+        for (std::uint32_t index = 0; index < slots.size(); index++)
+            if (slots[index].asset) remove({index, slots[index].generation});
+    }
+
+    /**
+     * @brief Resolves a handle.
+     * @return The asset, or nullptr if the handle is invalid or stale.
+     */
+    T *get(HandleType handle) const {
+        if (handle.index >= slots.size()) return nullptr;
+        const Slot &slot = slots[handle.index];
+        if (slot.generation != handle.generation) return nullptr;
+        return slot.asset.get();
+    }
+
+    /**
+     * @brief Finds the handle of a name by its hash.
+     * @return The handle, or an invalid handle if nothing was added under that name.
+     */
+    HandleType find(StringId id) const {
+        auto found = byName.find(id.value);
+        if (found == byName.end()) return {};
+        return {found->second, slots[found->second].generation};
+    }
+
+    /**
+     * @brief Finds the handle of a name, comparing the stored name as well.
+     */
+    HandleType find(std::string_view name) const {
+        HandleType handle = find(StringId::hash(name));
+        if (handle.isValid() && slots[handle.index].name != name) return {};
+        return handle;
+    }
+
+    /**
+     * @brief Checks whether an asset was added under a name.
+     */
+    bool contains(std::string_view name) const { return find(name).isValid(); }
+
+    /**
+     * @brief Gets the hashed name of a live handle, or a zero StringId.
+     */
+    StringId getId(HandleType handle) const {
+        return get(handle) != nullptr ? slots[handle.index].id : StringId{};
+    }
+
+    /**
+     * @brief Gets the name a live handle was added under, or an empty string.
+     */
+    const std::string &getName(HandleType handle) const {
+        static const std::string EMPTY;
+        return get(handle) != nullptr ? slots[handle.index].name : EMPTY;
+    }
+
+    /**
+     * @brief Gets the number of live assets.
+     */
+    std::size_t size() const { return byName.size(); }
+};
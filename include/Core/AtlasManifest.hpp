@@ -0,0 +1,53 @@
+/**
+ * @file AtlasManifest.hpp
+ * @brief Declares AtlasManifest, the binary index written by the atlas packer.
+ */
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * @struct AtlasManifest
+ * @brief Lists the page images of a texture atlas and where each sprite sits in them.
+ *
+ * Layout, all integers little endian:
+ * @code
+ * char[4]  magic "ATLS"
+ * u32      version (1)
+ * u32      page count, then per page:    u16 length, path bytes
+ * u32      sprite count, then per sprite: u16 length, name bytes,
+ *                                         u16 page, i32 x, y, width, height
+ * @endcode
+ * Page paths are relative to the manifest's directory.
+ */
+struct AtlasManifest {
+    static constexpr std::uint32_t VERSION = 1;
+
+    /**
+     * @struct Sprite
+     * @brief One packed image.
+     */
+    struct Sprite {
+        std::string name;     ///< Sprite ID, usually the source file name without extension.
+        std::uint16_t page;   ///< Index in pages.
+        sf::IntRect rect;     ///< Region of the page, in pixels.
+    };
+
+    std::vector<std::string> pages;  ///< Page image paths.
+    std::vector<Sprite> sprites;     ///< Packed sprites.
+
+    /**
+     * @brief Writes the manifest.
+     * @return False if the stream failed.
+     */
+    bool write(std::ostream &out) const;
+
+    /**
+     * @brief Reads a manifest, replacing the contents of this one.
+     * @return False if the data is truncated, from another version, or not a manifest.
+     */
+    bool read(std::istream &in);
+};
@@ -0,0 +1,229 @@
+/**
+ * @file EntityStore.hpp
+ * @brief Declares EntityStore, structure-of-arrays storage for large numbers of simple entities.
+ */
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "Core/AssetRegistry.hpp"
+
+/**
+ * @struct Entity
+ * @brief Identifies an entity; stale once the entity is destroyed.
+ */
+struct Entity {
+    static constexpr std::uint32_t INVALID = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t index = INVALID;  ///< Slot in the sparse table.
+    std::uint32_t generation = 0;   ///< Generation of the slot when the entity was created.
+    /**
+     * @brief Checks whether the entity was ever created; it may still be destroyed.
+     */
+    bool isValid() const { return index != INVALID; }
+    bool operator==(const Entity &) const = default;
+};
+
+/**
+ * @brief Bit set of the components an entity has.
+ */
+using ComponentMask = std::uint8_t;
+
+/**
+ * @namespace Component
+ * @brief Bits of ComponentMask.
+ */
+namespace Component {
+constexpr ComponentMask Position = 1 << 0;  ///< Position and previous position.
+constexpr ComponentMask Velocity = 1 << 1;  ///< Velocity, in pixels per tick.
+constexpr ComponentMask Health = 1 << 2;    ///< Hit points.
+constexpr ComponentMask Sprite = 1 << 3;    ///< Texture region to draw.
+}  // namespace Component
+
+/**
+ * @struct HealthComponent
+ * @brief Hit points of an entity.
+ */
+struct HealthComponent {
+    float current = 0.f;  ///< Remaining hit points.
+    float maximum = 0.f;  ///< Hit points when fully healed.
+};
+
+/**
+ * @struct SpriteComponent
+ * @brief What to draw for an entity.
+ */
+struct SpriteComponent {
+    TextureHandle texture;               ///< Texture to sample.
+    sf::IntRect textureRect;             ///< Region of the texture.
+    sf::Color color = sf::Color::White;  ///< Tint.
+    std::int16_t layer = 0;              ///< Draw order; lower layers are drawn first.
+};
+
+/**
+ * @class EntityStore
+ * @brief Sparse-set entity storage with one contiguous column per component.
+ *
+ * Live entities are packed into dense rows [0, size()). Every column has one
+ * element per row, and each row's mask says which components the entity
+ * really has. Systems walk the columns front to back with no indirection; an
+ * Entity only goes through the sparse table when it is looked up by ID.
+ *
+ * Destroying an entity moves the last row into its place, so destroy() must
+ * not be called while iterating rows; use queueDestroy() and flushDestroyed()
+ * instead.
+ */
+class EntityStore {
+   private:
+    static constexpr std::uint32_t NO_ROW = std::numeric_limits<std::uint32_t>::max();
+
+    std::vector<std::uint32_t> rowOf;        ///< Sparse table: entity index to dense row.
+    std::vector<std::uint32_t> generations;  ///< Current generation of each entity index.
+    std::vector<std::uint32_t> freeIndices;  ///< Entity indices available for reuse.
+    std::vector<Entity> pendingDestroy;      ///< Entities queued by queueDestroy().
+
+    std::vector<Entity> entities;                ///< Entity of each row.
+    std::vector<ComponentMask> masks;            ///< Components of each row.
+    std::vector<sf::Vector2f> positions;         ///< Position column.
+    std::vector<sf::Vector2f> previousPositions; ///< Position before the last integrate(), for interpolation.
+    std::vector<sf::Vector2f> velocities;        ///< Velocity column.
+    std::vector<HealthComponent> healths;        ///< Health column.
+    std::vector<SpriteComponent> sprites;        ///< Sprite column.
+
+    std::uint32_t getRow(Entity entity) const;
+
+   public:
+    /**
+     * @brief Reserves room for a number of entities so creation does not reallocate.
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * @brief Creates an entity.
+     * @param components Components the entity starts with; their values are default initialized.
+     */
+    Entity create(ComponentMask components = Component::Position);
+
+    /**
+     * @brief Destroys an entity immediately. Stale entities are ignored.
+     */
+    void destroy(Entity entity);
+
+    /**
+     * @brief Marks an entity for destruction by the next flushDestroyed(); safe during iteration.
+     */
+    void queueDestroy(Entity entity) { pendingDestroy.push_back(entity); }
+
+    /**
+     * @brief Destroys every entity passed to queueDestroy().
+     */
+    void flushDestroyed();
+
+    /**
+     * @brief Destroys every entity.
+     */
+    void clear();
+
+    /**
+     * @brief Checks whether an entity still exists.
+     */
+    bool isAlive(Entity entity) const { return getRow(entity) != NO_ROW; }
+
+    /**
+     * @brief Gets the number of live entities.
+     */
+    std::size_t size() const { return entities.size(); }
+
+    /**
+     * @brief Gets the heap memory held by the columns and index tables, including spare capacity.
+     */
+    std::size_t getMemoryUsage() const;
+
+    /**
+     * @brief Gets the dense row of an entity, for direct column access.
+     * @return The row, or size() if the entity is stale.
+     */
+    std::size_t rowOfEntity(Entity entity) const;
+
+    /**
+     * @brief Adds components to an entity, default initializing their values.
+     */
+    void addComponents(Entity entity, ComponentMask components);
+
+    /**
+     * @brief Removes components from an entity.
+     */
+    void removeComponents(Entity entity, ComponentMask components);
+
+    /**
+     * @brief Checks whether an entity has all of the given components.
+     */
+    bool hasComponents(Entity entity, ComponentMask components) const;
+
+    /**
+     * @brief Places an entity, also resetting its previous position so it does not interpolate.
+     */
+    void setPosition(Entity entity, sf::Vector2f position);
+
+    /**
+     * @name Row access
+     * Per-entity accessors. The entity must be alive.
+     * @{
+     */
+    sf::Vector2f &position(Entity entity) { return positions[getRow(entity)]; }
+    sf::Vector2f &velocity(Entity entity) { return velocities[getRow(entity)]; }
+    HealthComponent &health(Entity entity) { return healths[getRow(entity)]; }
+    SpriteComponent &sprite(Entity entity) { return sprites[getRow(entity)]; }
+    /** @} */
+
+    /**
+     * @name Column access
+     * Dense columns, indexed by row, for systems.
+     * @{
+     */
+    std::span<const Entity> getEntities() const { return entities; }
+    std::span<const ComponentMask> getMasks() const { return masks; }
+    std::span<sf::Vector2f> getPositions() { return positions; }
+    std::span<const sf::Vector2f> getPositions() const { return positions; }
+    std::span<const sf::Vector2f> getPreviousPositions() const { return previousPositions; }
+    std::span<sf::Vector2f> getVelocities() { return velocities; }
+    std::span<HealthComponent> getHealths() { return healths; }
+    std::span<SpriteComponent> getSprites() { return sprites; }
+    std::span<const SpriteComponent> getSprites() const { return sprites; }
+    /** @} */
+
+    /**
+     * @brief Calls a function with the row of every entity having all required components.
+     * @param required Components the entity must have.
+     * @param function Called as function(std::size_t row); must not create or destroy entities.
+     */
+    template <typename Function>
+    void forEach(ComponentMask required, Function &&function) {
+        const std::size_t count = masks.size();
+        for (std::size_t row = 0; row < count; row++)
+            if ((masks[row] & required) == required) function(row);
+    }
+
+    /**
+     * @brief Movement system: remembers positions, then adds velocity to every moving entity.
+     */
+    void integrate();
+
+    /**
+     * @brief Gets an entity's position blended between the last two ticks.
+     * @param row Dense row of the entity.
+     * @param alpha Interpolation alpha in [0, 1].
+     */
+    sf::Vector2f getInterpolatedPosition(std::size_t row, float alpha) const {
+        return previousPositions[row] + (positions[row] - previousPositions[row]) * alpha;
+    }
+
+    /**
+     * @brief Health system: queues every entity whose health dropped to zero for destruction.
+     * @return Number of entities queued.
+     */
+    std::size_t queueDead();
+};
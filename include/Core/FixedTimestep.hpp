@@ -0,0 +1,57 @@
+/**
+ * @file FixedTimestep.hpp
+ * @brief Declares the FixedTimestep class, an accumulator that converts frame time into simulation ticks.
+ */
+#pragma once
+#include <cstdint>
+
+#include "Base/Constants.hpp"
+/**
+ * @class FixedTimestep
+ * @brief Accumulates real elapsed time and hands it out as whole fixed-length ticks.
+ *
+ * The game loop feeds the duration of each frame into advance() and runs as many
+ * ticks as it returns. The number of catch-up ticks per frame is capped so that a
+ * long stall drops time instead of snowballing into ever longer frames. The
+ * leftover fraction of a tick is exposed as an interpolation alpha for rendering.
+ */
+class FixedTimestep {
+   private:
+    float tickInterval;          ///< Length of one simulation tick in seconds.
+    int maxTicksPerFrame;        ///< Upper bound on ticks returned by one advance() call.
+    float accumulator;           ///< Unsimulated time carried over between frames.
+    std::uint64_t tickCount;     ///< Total number of ticks handed out so far.
+    float droppedTime;           ///< Total time discarded because of the catch-up cap.
+
+   public:
+    /**
+     * @brief Constructs a FixedTimestep.
+     * @param tickInterval Length of one tick in seconds.
+     * @param maxTicksPerFrame Maximum number of ticks to run in a single frame.
+     */
+    FixedTimestep(float tickInterval = GameConstants::TICK_INTERVAL,
+                  int maxTicksPerFrame = GameConstants::MAX_TICKS_PER_FRAME);
+    /**
+     * @brief Adds elapsed frame time and returns the number of ticks to simulate.
+     * @param elapsedSeconds Real time spent since the previous call.
+     * @return Number of ticks to run this frame, never more than maxTicksPerFrame.
+     */
+    int advance(float elapsedSeconds);
+    /**
+     * @brief Gets how far the simulation is into the next tick.
+     * @return Value in [0, 1) used to interpolate between the last two ticks.
+     */
+    float getAlpha() const { return accumulator / tickInterval; }
+    /**
+     * @brief Gets the number of ticks handed out since construction.
+     */
+    std::uint64_t getTickCount() const { return tickCount; }
+    /**
+     * @brief Gets the total simulation time dropped by the catch-up cap.
+     */
+    float getDroppedTime() const { return droppedTime; }
+    /**
+     * @brief Gets the tick length in seconds.
+     */
+    float getTickInterval() const { return tickInterval; }
+};
@@ -0,0 +1,120 @@
+/**
+ * @file HeadlessRunner.hpp
+ * @brief Declares HeadlessRunner, which drives scenes for a fixed number of ticks without a window.
+ */
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Core/InputManager.hpp"
+#include "Core/InputRecorder.hpp"
+#include "Core/JobSystem.hpp"
+#include "Core/NullRenderTarget.hpp"
+#include "Core/SceneManager.hpp"
+#include "Utility/FrameArena.hpp"
+
+/**
+ * @struct HeadlessOptions
+ * @brief Settings for a headless run.
+ */
+struct HeadlessOptions {
+    std::uint32_t ticks = 600;   ///< Number of fixed ticks to simulate.
+    bool render = true;          ///< Whether to call SceneManager::render every tick.
+    bool useRenderTexture = true;  ///< Render off-screen; falls back to a NullRenderTarget if unavailable.
+    sf::Vector2u size{1200, 800};  ///< Size of the render target.
+    std::size_t jobWorkers = JobSystem::defaultWorkerCount(); ///< Worker threads of the scenes' JobSystem.
+    /**
+     * @brief Optional allocation counter for the calling thread, e.g. from benchmarks/AllocationCounter.hpp.
+     */
+    std::size_t (*countAllocations)() = nullptr;
+};
+
+/**
+ * @struct HeadlessReport
+ * @brief Timing and allocation results of a headless run.
+ */
+struct HeadlessReport {
+    /// Upper bounds of the tick time histogram buckets in milliseconds; the last bucket is unbounded.
+    static constexpr std::array<double, 8> BUCKET_LIMITS{0.25, 0.5, 1.0, 2.0, 4.0, 8.0, 16.67, 33.33};
+
+    std::string scene;                 ///< Name of the scene that was run.
+    std::string targetKind;            ///< "render_texture", "null" or "none".
+    std::uint32_t ticks = 0;           ///< Ticks simulated.
+    double totalSeconds = 0.0;         ///< Wall time of the whole run.
+    double ticksPerSecond = 0.0;       ///< Simulation throughput.
+    double p50Milliseconds = 0.0;      ///< Median tick time.
+    double p99Milliseconds = 0.0;      ///< 99th percentile tick time.
+    double maxMilliseconds = 0.0;      ///< Slowest tick.
+    std::array<std::uint32_t, BUCKET_LIMITS.size() + 1> histogram{}; ///< Tick count per bucket.
+    bool countedAllocations = false;   ///< Whether allocation fields are meaningful.
+    std::size_t allocations = 0;       ///< Heap allocations during all ticks.
+    std::size_t maxAllocationsPerTick = 0; ///< Most allocations made by a single tick.
+
+    /**
+     * @brief Serializes the report as a single-line JSON object.
+     */
+    std::string toJson() const;
+};
+
+/**
+ * @class HeadlessRunner
+ * @brief Runs the scene pipeline tick by tick from a scripted input stream.
+ *
+ * Every tick delivers that tick's scripted events through InputManager and
+ * SceneManager, then calls handleInput, update and (optionally) render, just
+ * like one fixed tick of Application::run. Time never comes from a clock, so
+ * two runs with the same script simulate exactly the same thing; a script
+ * can also come from a session captured with InputRecorder.
+ */
+class HeadlessRunner {
+   private:
+    HeadlessOptions options;                       ///< Settings for this runner.
+    NullRenderTarget nullTarget;                   ///< Fallback target when no GL context is available.
+    std::unique_ptr<sf::RenderTexture> texture;    ///< Off-screen target, null if not used.
+    sf::RenderTarget &target;                      ///< The target scenes render into.
+    InputManager inputManager;                     ///< Input states fed by the script.
+    FrameArena frameArena;                         ///< Scratch memory of scenes, reset after every tick.
+    JobSystem jobSystem;                           ///< Worker threads scenes submit update jobs to.
+    SceneManager sceneManager;                     ///< Scenes under test; declared after their services so it dies first.
+
+    static std::unique_ptr<sf::RenderTexture> createTexture(const HeadlessOptions &options);
+
+   public:
+    /**
+     * @brief Creates the render target and the managers.
+     * @param options Settings for the run.
+     */
+    explicit HeadlessRunner(const HeadlessOptions &options);
+    /**
+     * @brief Gets the scene manager, to register and select scenes before running.
+     */
+    SceneManager &getSceneManager() { return sceneManager; }
+    /**
+     * @brief Gets the input manager, to subscribe observers before running.
+     */
+    InputManager &getInputManager() { return inputManager; }
+    /**
+     * @brief Simulates options.ticks ticks of the current scene.
+     * @param script Events to deliver, sorted by tick.
+     * @return Timing and allocation statistics.
+     */
+    HeadlessReport run(const std::vector<ScriptedEvent> &script);
+    /**
+     * @brief Parses an input script, one event per line.
+     *
+     * Lines look like "10 key_press Space", "12 key_release Space",
+     * "30 mouse_press Left 400 300", "31 mouse_release Left 400 300" and
+     * "40 mouse_move 100 200". Blank lines and lines starting with '#' are
+     * ignored; malformed lines are logged and skipped.
+     *
+     * @param input Stream to read the script from.
+     * @return The events, sorted by tick.
+     */
+    static std::vector<ScriptedEvent> parseScript(std::istream &input);
+};
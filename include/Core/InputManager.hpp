@@ -16,13 +16,13 @@
 class InputManager {
     MouseState mouseState;  ///< Manages mouse button subscriptions and events.
     KeyboardState keyboardState;
-    sf::RenderWindow& window;  ///< Reference to the main window.
+    sf::RenderTarget& target;  ///< Target whose view maps pixels to world coordinates.
    public:
     /**
-     * @brief Constructs an InputManager for the given window.
-     * @param window Reference to the SFML render window.
+     * @brief Constructs an InputManager for the given render target.
+     * @param target Reference to the main window or an off-screen render target.
      */
-    InputManager(sf::RenderWindow& window);
+    InputManager(sf::RenderTarget& target);
     /**
      * @brief Handles an input event.
      * @param event Optional SFML event to handle.
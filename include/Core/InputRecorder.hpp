@@ -0,0 +1,113 @@
+/**
+ * @file InputRecorder.hpp
+ * @brief Declares InputRecorder, which captures a session's input for exact replay, and its file format.
+ */
+#pragma once
+#include <SFML/Window.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <optional>
+#include <vector>
+
+/**
+ * @struct ScriptedEvent
+ * @brief An input event delivered right before the given tick runs.
+ */
+struct ScriptedEvent {
+    std::uint32_t tick; ///< Zero-based tick the event is delivered on.
+    sf::Event event;    ///< The event itself.
+};
+
+/**
+ * @struct InputRecording
+ * @brief A recorded session: its events and how long it ran.
+ */
+struct InputRecording {
+    std::uint32_t tickRate = 0;          ///< Ticks per second of the recording game.
+    std::uint32_t ticks = 0;             ///< Ticks the session ran for.
+    std::vector<ScriptedEvent> events;   ///< Events in delivery order.
+};
+
+/**
+ * @class InputRecorder
+ * @brief Streams every input event and the tick it arrived before into a compact binary file.
+ *
+ * Scenes only see input through events, so delivering the same events
+ * before the same ticks replays a session exactly; HeadlessRunner does that
+ * headless and as fast as the scene runs, turning a stutter reported from a
+ * play session into a repeatable benchmark.
+ *
+ * The file is "INPR", a version and the tick rate, followed by one record
+ * per event: the tick as a varint delta from the previous record, a type
+ * byte and the event's fields as varints. An end record stores the length
+ * of the session. A file cut short by a crash still loads up to its last
+ * complete record. Event types the format does not know are skipped.
+ */
+class InputRecorder {
+   private:
+    std::ofstream file;             ///< Output; closed when not recording.
+    std::uint32_t lastTick = 0;     ///< Tick of the last record written.
+    std::size_t recorded = 0;       ///< Events written.
+    std::size_t skipped = 0;        ///< Events of types the format cannot store.
+    std::vector<char> buffer;       ///< Encoding buffer, reused between events.
+
+   public:
+    static constexpr std::uint16_t VERSION = 1; ///< Format version written and accepted.
+
+    InputRecorder() = default;
+    InputRecorder(const InputRecorder &) = delete;
+    InputRecorder &operator=(const InputRecorder &) = delete;
+
+    /**
+     * @brief Destructor. Ends the recording at the tick of its last event.
+     */
+    ~InputRecorder();
+
+    /**
+     * @brief Starts recording into a file, replacing it.
+     * @param tickRate Ticks per second of the game, stored so replays can check they match.
+     * @return False if the file cannot be written.
+     */
+    bool open(const std::filesystem::path &path, std::uint32_t tickRate);
+
+    /**
+     * @brief Checks whether a recording is in progress.
+     */
+    bool isOpen() const { return file.is_open(); }
+
+    /**
+     * @brief Appends an event.
+     * @param tick Tick the event is handled before, i.e. the number of ticks run so far.
+     */
+    void record(std::uint32_t tick, const sf::Event &event);
+
+    /**
+     * @brief Writes the end record and closes the file.
+     * @param ticks Number of ticks the session ran for.
+     */
+    void close(std::uint32_t ticks);
+
+    /**
+     * @brief Gets the number of events written.
+     */
+    std::size_t getEventCount() const { return recorded; }
+
+    /**
+     * @brief Gets the number of events skipped because the format cannot store them.
+     */
+    std::size_t getSkippedCount() const { return skipped; }
+
+    /**
+     * @brief Reads a recording.
+     * @return The recording, or std::nullopt if the stream is not a recording of a known version.
+     */
+    static std::optional<InputRecording> read(std::istream &input);
+
+    /**
+     * @brief Reads a recording from a file, see read().
+     */
+    static std::optional<InputRecording> load(const std::filesystem::path &path);
+};
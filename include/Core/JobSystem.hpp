@@ -0,0 +1,238 @@
+/**
+ * @file JobSystem.hpp
+ * @brief Declares JobSystem, a work-stealing scheduler for fanning a tick out across cores, and TaskGraph.
+ */
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @class JobCounter
+ * @brief Number of unfinished jobs of a batch; JobSystem::wait() returns once it drops to zero.
+ */
+class JobCounter {
+   private:
+    friend class JobSystem;
+    std::atomic<std::uint32_t> pending{0}; ///< Jobs submitted against the counter and not finished.
+
+   public:
+    /**
+     * @brief Checks whether every job of the batch finished.
+     */
+    bool isDone() const { return pending.load(std::memory_order_acquire) == 0; }
+};
+
+/**
+ * @class JobSystem
+ * @brief Runs small jobs on worker threads that steal from each other when idle.
+ *
+ * Every worker owns a deque: it pushes and pops its own jobs at the back,
+ * newest first while they are hot in cache, and idle workers steal the
+ * oldest job from the front of a random victim. Threads that are not
+ * workers, like the game loop, share one more deque.
+ *
+ * Waiting never blocks a thread that could work: wait() runs queued jobs
+ * until the counter drops to zero, so jobs may wait on jobs they submitted,
+ * and a system with zero workers runs everything on the waiting thread.
+ * Jobs should not throw; an escaping exception is logged and the job counts
+ * as finished.
+ */
+class JobSystem {
+   private:
+    /**
+     * @brief A queued piece of work: a range handed to a function.
+     */
+    struct Job {
+        void (*function)(void *context, std::size_t begin, std::size_t end); ///< Work to run.
+        void *context;          ///< First argument of function.
+        std::size_t begin;      ///< Start of the range.
+        std::size_t end;        ///< End of the range.
+        JobCounter *counter;    ///< Decremented when the job finishes.
+    };
+
+    /**
+     * @brief A thread's deque, on its own cache line.
+     */
+    struct alignas(64) WorkQueue {
+        std::mutex mutex;       ///< Guards jobs.
+        std::deque<Job> jobs;   ///< Owner works at the back, thieves at the front.
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues; ///< One per worker, then the shared one of other threads.
+    std::vector<std::thread> workers;          ///< Worker threads.
+    std::atomic<std::size_t> queuedJobs{0};    ///< Jobs sitting in any queue.
+    std::atomic<std::size_t> sleepingWorkers{0}; ///< Workers waiting on wakeUp.
+    std::atomic<std::uint64_t> steals{0};      ///< Jobs taken from another thread's queue.
+    std::mutex sleepMutex;                     ///< Guards sleeping.
+    std::condition_variable wakeUp;            ///< Signalled when jobs arrive or the system stops.
+    std::atomic<bool> stopping{false};         ///< Set by the destructor.
+
+    void workerLoop(std::size_t index);
+
+    /**
+     * @brief Gets the queue the calling thread pushes to and pops from.
+     */
+    std::size_t ownQueue() const;
+
+    void push(const Job &job);
+
+    /**
+     * @brief Takes a job from the thread's own queue, or steals one.
+     * @return False if every queue is empty.
+     */
+    bool tryRunJob(std::size_t own);
+
+    static void execute(const Job &job);
+
+    template <typename Function>
+    static void runOwned(void *context, std::size_t, std::size_t) {
+        std::unique_ptr<Function> function(static_cast<Function *>(context));
+        (*function)();
+    }
+
+    template <typename Function>
+    static void runRange(void *context, std::size_t begin, std::size_t end) {
+        (*static_cast<Function *>(context))(begin, end);
+    }
+
+   public:
+    /**
+     * @brief Starts the workers.
+     * @param workerCount Number of worker threads; with 0 every job runs inside wait().
+     */
+    explicit JobSystem(std::size_t workerCount = defaultWorkerCount());
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    /**
+     * @brief Runs the queued jobs and joins the workers.
+     */
+    ~JobSystem();
+
+    /**
+     * @brief Queues a job.
+     * @param function Callable taking no arguments; copied into one heap allocation.
+     * @param counter Counter to wait on; must outlive the job.
+     */
+    template <typename Function>
+    void submit(Function &&function, JobCounter &counter) {
+        using Stored = std::decay_t<Function>;
+        counter.pending.fetch_add(1, std::memory_order_relaxed);
+        push({&runOwned<Stored>, new Stored(std::forward<Function>(function)), 0, 0, &counter});
+    }
+
+    /**
+     * @brief Splits [begin, end) into chunks, runs body(chunkBegin, chunkEnd) on each and waits for all.
+     *
+     * Chunks are queued oldest first, so thieves take the far end of the range.
+     * @param grain Elements per chunk; 0 picks about four chunks per thread.
+     */
+    template <typename Function>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Function &&body) {
+        if (begin >= end) return;
+        if (grain == 0) grain = std::max<std::size_t>(1, (end - begin) / (4 * getThreadCount()));
+        if (end - begin <= grain) {
+            body(begin, end);
+            return;
+        }
+        using Body = std::remove_reference_t<Function>;
+        JobCounter counter;
+        for (std::size_t chunk = begin; chunk < end; chunk += grain) {
+            counter.pending.fetch_add(1, std::memory_order_relaxed);
+            push({&runRange<Body>, const_cast<void *>(static_cast<const void *>(&body)), chunk,
+                  std::min(end, chunk + grain), &counter});
+        }
+        wait(counter);
+    }
+
+    /**
+     * @brief Runs jobs until every job submitted against the counter finished.
+     */
+    void wait(JobCounter &counter);
+
+    /**
+     * @brief Gets the number of worker threads.
+     */
+    std::size_t getWorkerCount() const { return workers.size(); }
+
+    /**
+     * @brief Gets the number of threads that run jobs: the workers and the waiting thread.
+     */
+    std::size_t getThreadCount() const { return workers.size() + 1; }
+
+    /**
+     * @brief Gets the number of jobs taken from another thread's queue so far.
+     */
+    std::uint64_t getStealCount() const { return steals.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief One worker per hardware thread, leaving one for the game loop.
+     */
+    static std::size_t defaultWorkerCount();
+};
+
+/**
+ * @class TaskGraph
+ * @brief A set of tasks and the order between them, run on a JobSystem.
+ *
+ * Describes a tick's update as stages, e.g. movement, then the spatial index
+ * rebuild, then targeting, then projectile resolution. Each task gets a
+ * counter of unfinished predecessors; the task that finishes last submits
+ * its successor, so independent branches run side by side without a barrier
+ * between every stage. A task may itself call JobSystem::parallelFor. The
+ * graph can be run once per tick.
+ */
+class TaskGraph {
+   public:
+    using TaskId = std::size_t;
+
+   private:
+    /**
+     * @brief One task and its edges.
+     */
+    struct Task {
+        std::function<void()> work;            ///< What the task does.
+        std::vector<TaskId> successors;        ///< Tasks waiting for this one.
+        std::uint32_t predecessors = 0;        ///< Tasks this one waits for.
+        std::atomic<std::uint32_t> remaining{0}; ///< Predecessors not finished in the current run.
+    };
+
+    std::vector<std::unique_ptr<Task>> tasks; ///< Every task, by ID.
+    JobSystem *system = nullptr;             ///< System of the current run.
+    JobCounter counter;                      ///< Unfinished tasks of the current run.
+
+    void start(TaskId task);
+
+   public:
+    /**
+     * @brief Adds a task.
+     * @return ID to order the task with precede().
+     */
+    TaskId add(std::function<void()> work);
+
+    /**
+     * @brief Makes one task wait for another.
+     */
+    void precede(TaskId before, TaskId after);
+
+    /**
+     * @brief Runs every task once in dependency order and waits for all of them.
+     */
+    void run(JobSystem &jobSystem);
+
+    /**
+     * @brief Gets the number of tasks.
+     */
+    std::size_t size() const { return tasks.size(); }
+};
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+
+#include "Core/ObserverList.hpp"
 class KeyboardState;
 enum class Key;
 enum class UserEvent;
@@ -26,8 +28,9 @@ class KeyboardObserver {
      * @param key The key to observe.
      * @param event The user-defined event (e.g., Press, Release).
      * @param state Reference to the KeyboardState managing subscriptions.
+     * @return Handle that can later be passed to KeyboardState::removeSubscriber.
      */
-    void subscribeKeyboard(Key key, UserEvent event, KeyboardState& state);
+    SubscriptionHandle subscribeKeyboard(Key key, UserEvent event, KeyboardState& state);
 
     /**
      * @brief Unsubscribe from a specific key and user event combination.
@@ -8,11 +8,13 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include "Core/ObserverList.hpp"
 #include "Core/UserEvent.hpp"
+#include "Utility/LogFormat.hpp"
+#include "Utility/SignalMap.hpp"
 
+#include <array>
 #include <optional>
-#include <map>
-#include <list>
 class KeyboardObserver;
 
 /**
@@ -40,6 +42,14 @@ enum class Key {
     KeyCount // Keep this last
 };
 
+/**
+ * @brief Lets Logger::logf print keys by name.
+ */
+template <>
+struct LogFormatter<Key> {
+    static void format(LogBuffer &buffer, Key key) { buffer.append(SignalMap::getKeyName(key)); }
+};
+
 /**
  * @class KeyboardState
  * @brief Manages keyboard event subscriptions and dispatching using the observer pattern.
@@ -51,22 +61,35 @@ enum class Key {
 class KeyboardState {
 
     private: 
-    sf::RenderWindow &window; ///< Reference to the SFML window for event context.
-    std::map<Key, std::map<UserEvent, std::list<KeyboardObserver*>>> subscriberList;    ///< Subscription map.
+    static constexpr std::size_t KEY_COUNT = static_cast<std::size_t>(Key::KeyCount);
+    static constexpr std::size_t EVENT_COUNT = static_cast<std::size_t>(UserEvent::EventCount);
+
+    sf::RenderTarget &target; ///< Target whose view maps pixels to world coordinates.
+    sf::Vector2i mousePosition; ///< Last cursor position seen in a mouse event, in window coordinates.
+    /**
+     * @brief Dense [Key][UserEvent] subscription table, indexed directly by enum value.
+     */
+    std::array<std::array<ObserverList<KeyboardObserver>, EVENT_COUNT>, KEY_COUNT> subscriberList;
+
+    /**
+     * @brief Gets the observer list for a key and event.
+     */
+    ObserverList<KeyboardObserver>& getList(Key key, UserEvent event);
     public:
     /**
-     * @brief Construct a KeyboardState for a given window.
-     * @param window Reference to the SFML RenderWindow.
+     * @brief Construct a KeyboardState for a given render target.
+     * @param target Reference to the main window or an off-screen render target.
      */
-    KeyboardState(sf::RenderWindow &window);
+    KeyboardState(sf::RenderTarget &target);
 
     /**
      * @brief Add an observer for a specific key and user event.
      * @param key The key to observe.
      * @param event The user-defined event.
      * @param subscriber Pointer to the observer.
+     * @return Handle for O(1) removal, or an invalid handle if already subscribed.
      */
-    void addSubscriber(Key key, UserEvent event, KeyboardObserver* subscriber);
+    SubscriptionHandle addSubscriber(Key key, UserEvent event, KeyboardObserver* subscriber);
 
     /**
      * @brief Remove an observer for a specific key and user event.
@@ -76,6 +99,12 @@ class KeyboardState {
      */
     void removeSubscriber(Key key, UserEvent event, KeyboardObserver* subscriber);
 
+    /**
+     * @brief Remove the subscription identified by a handle in constant time.
+     * @param handle Handle returned by addSubscriber.
+     */
+    void removeSubscriber(const SubscriptionHandle &handle);
+
     /**
      * @brief Remove all observers for a specific key and user event.
      * @param key The key to clear.
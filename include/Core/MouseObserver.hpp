@@ -12,8 +12,11 @@
 #include <SFML/Graphics.hpp>
 #include <functional>
 #include <unordered_map>
+
+#include "Core/ObserverList.hpp"
 // Forward declarations to avoid circular dependency
 class MouseState;
+struct MouseRegion;
 /**
  * @enum Mouse
  * @brief Enum representing mouse buttons that can be observed.
@@ -41,9 +44,21 @@ class MouseObserver {
      * @param button The mouse button to observe.
      * @param event The mouse event type to observe (press, release, etc.).
      * @param mouseState The MouseState to subscribe to.
+     * @return Handle that can later be passed to MouseState::removeSubscriber.
+     */
+    virtual SubscriptionHandle subscribeMouse(Mouse button, UserEvent event,
+                                              MouseState& mouseState);
+    /**
+     * @brief Subscribe this observer to a mouse button event, only within a region.
+     * @param button The mouse button to observe.
+     * @param event The mouse event type to observe (press, release, etc.).
+     * @param mouseState The MouseState to subscribe to.
+     * @param region Hit box, coordinate space and z-order of this observer.
+     * @return Handle for MouseState::setSubscriberBounds and removeSubscriber.
      */
-    virtual void subscribeMouse(Mouse button, UserEvent event,
-                           MouseState& mouseState);
+    SubscriptionHandle subscribeMouse(Mouse button, UserEvent event,
+                                      MouseState& mouseState,
+                                      const MouseRegion& region);
     /**
      * @brief Unsubscribe this observer from a mouse button event in the given
      * MouseState.
@@ -67,4 +82,20 @@ class MouseObserver {
     virtual void onMouseEvent(Mouse button, UserEvent event,
                               const sf::Vector2f& worldPosition,
                               const sf::Vector2i& windowPosition) = 0;
+    /**
+     * @brief Called instead of onMouseEvent when the cursor is inside this
+     * observer's region.
+     *
+     * The default forwards to onMouseEvent and consumes the event. Return
+     * false to let the event through to the regions below and then to the
+     * observers subscribed without a region.
+     *
+     * @return True if the event is consumed.
+     */
+    virtual bool onMouseHit(Mouse button, UserEvent event,
+                            const sf::Vector2f& worldPosition,
+                            const sf::Vector2i& windowPosition) {
+        onMouseEvent(button, event, worldPosition, windowPosition);
+        return true;
+    }
 };
\ No newline at end of file
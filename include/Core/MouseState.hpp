@@ -6,18 +6,21 @@
  * This class allows observers to subscribe to mouse button events (left or
  * right) and be notified when those events occur.
  *
- * Dependencies: SFML/Graphics.hpp, <map>, <optional>, <list>, and a forward
- * declaration of MouseObserver.
+ * Dependencies: SFML/Graphics.hpp, <array>, <optional>, ObserverList.hpp, and a
+ * forward declaration of MouseObserver.
  */
 
 #pragma once
 
 #include <SFML/Graphics.hpp>
-#include <list>
-#include <map>
+#include <array>
+#include <cstdint>
 #include <optional>
+#include <vector>
 
+#include "Core/ObserverList.hpp"
 #include "UserEvent.hpp"
+#include "Utility/SpatialHash.hpp"
 // Forward declaration to break circular dependency
 class MouseObserver;
 
@@ -25,7 +28,26 @@ class MouseObserver;
  * @enum Mouse
  * @brief Enum representing mouse buttons that can be observed.
  */
-enum class Mouse { Left, Right };
+enum class Mouse { Left, Right, ButtonCount /* Keep this last */ };
+
+/**
+ * @enum MouseSpace
+ * @brief Coordinate space a MouseRegion is expressed in.
+ */
+enum class MouseSpace {
+    Screen, ///< Window pixels; for HUD elements that ignore the camera.
+    World   ///< World coordinates under the target's current view.
+};
+
+/**
+ * @struct MouseRegion
+ * @brief Area an observer occupies for hit testing.
+ */
+struct MouseRegion {
+    sf::FloatRect bounds;              ///< Hit box, in the coordinates of space.
+    MouseSpace space = MouseSpace::Screen; ///< Space of bounds.
+    int zOrder = 0;                    ///< Higher values are hit first.
+};
 
 /**
  * @class MouseState
@@ -34,19 +56,82 @@ enum class Mouse { Left, Right };
  * MouseState allows objects to subscribe to specific mouse button events and be
  *notified when those events occur. Observers are managed as pointers and
  *grouped by mouse button.
+ *
+ * Observers subscribed with a MouseRegion are hit-tested through a spatial
+ * index, so a click only reaches the regions under the cursor. They are tried
+ * from the highest z-order down until one consumes the event (see
+ * MouseObserver::onMouseHit). If nobody consumes it, it is broadcast to the
+ * observers subscribed without a region, as before.
  */
 class MouseState {
    private:
-    sf::RenderWindow &window;
+    static constexpr std::size_t BUTTON_COUNT =
+        static_cast<std::size_t>(Mouse::ButtonCount);
+    static constexpr std::size_t EVENT_COUNT =
+        static_cast<std::size_t>(UserEvent::EventCount);
+
+    sf::RenderTarget &target; ///< Target whose view maps pixels to world coordinates.
     /**
-     * @brief Maps each mouse button to a list of pointers to MouseObserver
-     * objects that are subscribed to that button's events.
+     * @brief Dense [Mouse][UserEvent] table of the observers subscribed to
+     * each button event, indexed directly by enum value.
      */
-    std::map<Mouse, std::map<UserEvent, std::list<MouseObserver *>>>
+    std::array<std::array<ObserverList<MouseObserver>, EVENT_COUNT>,
+               BUTTON_COUNT>
         subscriberList;
 
+    static constexpr std::size_t LIST_COUNT = BUTTON_COUNT * EVENT_COUNT;
+    static constexpr float HIT_CELL_SIZE = 64.f; ///< Grid cell size of the hit indices.
+
+    /**
+     * @brief One subscription with a region.
+     */
+    struct BoundedSubscriber {
+        MouseObserver *observer = nullptr; ///< Subscribed observer, null if the slot is free.
+        MouseRegion region;                ///< Where the observer can be hit.
+        std::uint64_t order = 0;           ///< Subscription order, breaks z-order ties.
+        std::uint32_t generation = 0;      ///< Bumped when the slot is freed.
+    };
+
+    /**
+     * @brief Bounded subscribers of one button event and their spatial indices.
+     */
+    struct HitLayer {
+        std::vector<BoundedSubscriber> subscribers; ///< Slots, indexed by handle slot.
+        std::vector<std::uint32_t> freeSlots;       ///< Free slot indices.
+        SpatialHash screenIndex{HIT_CELL_SIZE};     ///< Slots with screen-space regions.
+        SpatialHash worldIndex{HIT_CELL_SIZE};      ///< Slots with world-space regions.
+    };
+
+    /**
+     * @brief Dense [Mouse][UserEvent] table of the bounded subscribers.
+     */
+    std::array<std::array<HitLayer, EVENT_COUNT>, BUTTON_COUNT> hitLayers;
+    std::uint64_t subscriptionCounter = 0;  ///< Source of BoundedSubscriber::order.
+    std::vector<std::uint64_t> hitScratch;  ///< Reused list of (generation, slot) pairs under the cursor.
+    std::vector<std::uint32_t> queryScratch; ///< Reused spatial query result.
+
+    /**
+     * @brief Gets the observer list for a button and event.
+     */
+    ObserverList<MouseObserver> &getList(Mouse button, UserEvent event);
+
+    /**
+     * @brief Gets the hit layer for a button and event.
+     */
+    HitLayer &getLayer(Mouse button, UserEvent event);
+
+    /**
+     * @brief Frees a bounded subscription slot.
+     */
+    void releaseBounded(HitLayer &layer, std::uint32_t slot);
+
+    /**
+     * @brief Notifies the observers of one button event: hit regions first, then broadcast.
+     */
+    void dispatch(Mouse button, UserEvent event, sf::Vector2i windowPosition);
+
    public:
-    MouseState(sf::RenderWindow &window);
+    MouseState(sf::RenderTarget &target);
     /**
      * @brief Handles an SFML event and notifies relevant observers if it is a
      * mouse button event.
@@ -59,9 +144,31 @@ class MouseState {
      * specified mouse button.
      * @param button The mouse button to subscribeMouse to.
      * @param subscriber Pointer to the MouseObserver to add.
+     * @return Handle for O(1) removal, or an invalid handle if already
+     * subscribed.
      */
-    void addSubscriber(Mouse button, UserEvent event,
-                       MouseObserver *subscriber);
+    SubscriptionHandle addSubscriber(Mouse button, UserEvent event,
+                                     MouseObserver *subscriber);
+
+    /**
+     * @brief Subscribes an observer that is only notified when the cursor is inside a region.
+     * @param button The mouse button to subscribe to.
+     * @param event The event to subscribe to.
+     * @param subscriber Pointer to the MouseObserver to add.
+     * @param region Hit box, its coordinate space and z-order.
+     * @return Handle for moving the region or removing the subscription.
+     */
+    SubscriptionHandle addSubscriber(Mouse button, UserEvent event,
+                                     MouseObserver *subscriber,
+                                     const MouseRegion &region);
+
+    /**
+     * @brief Moves or resizes the region of a bounded subscription.
+     * @param handle Handle returned by the region overload of addSubscriber.
+     * @param bounds New hit box, in the subscription's coordinate space.
+     */
+    void setSubscriberBounds(const SubscriptionHandle &handle,
+                             const sf::FloatRect &bounds);
 
     /**
      * @brief Removes a MouseObserver pointer from the subscriber list for the
@@ -72,6 +179,12 @@ class MouseState {
     void removeSubscriber(Mouse button, UserEvent event,
                           MouseObserver *subscriber);
 
+    /**
+     * @brief Removes the subscription identified by a handle in constant time.
+     * @param handle Handle returned by addSubscriber.
+     */
+    void removeSubscriber(const SubscriptionHandle &handle);
+
     /**
      * @brief Removes all subscribers from all mouse buttons.
      */
@@ -0,0 +1,129 @@
+/**
+ * @file MusicPlayer.hpp
+ * @brief Declares MusicPlayer, which streams background music and crossfades between tracks.
+ */
+#pragma once
+#include <SFML/System.hpp>
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "Core/MusicStream.hpp"
+
+class AssetPack;
+
+/**
+ * @struct MusicConfig
+ * @brief Construction settings of a MusicPlayer.
+ */
+struct MusicConfig {
+    std::size_t memoryCapBytes = 256 * 1024;   ///< Decode memory shared by both streams, see MusicPlayer.
+    sf::Time crossfade = sf::milliseconds(1500); ///< Fade used by play() and stop() when none is given.
+    float volume = 100.f;                       ///< Master music volume in [0, 100].
+};
+
+/**
+ * @class MusicPlayer
+ * @brief Streams long tracks from disk or the asset pack, fading between them.
+ *
+ * Two MusicStream objects are created up front: the one playing and the one
+ * fading out. Starting a track reuses the idle stream, so switching tracks
+ * does not allocate. Each stream gets half of the memory cap as its decode
+ * buffer; SFML keeps a few buffers of that size queued per stream, so the
+ * resident music memory is a small constant independent of track length.
+ *
+ * Volumes are only changed by update(), which must be called once per frame.
+ */
+class MusicPlayer {
+   private:
+    /**
+     * @brief One stream and its fade state.
+     */
+    struct Track {
+        std::unique_ptr<MusicStream> stream; ///< Created once, reopened per track.
+        std::string path;                    ///< Track being played; empty when idle.
+        float gain = 0.f;                    ///< Fade level in [0, 1].
+        float fadeRate = 0.f;                ///< Gain change per second; negative while fading out.
+    };
+
+    const AssetPack &pack;     ///< Checked for the track before the disk.
+    std::filesystem::path assetRoot; ///< Prefix of tracks read from disk.
+    MusicConfig config;        ///< Settings given at construction; volume may change.
+    std::array<Track, 2> tracks; ///< Playing and fading-out streams.
+    std::size_t current = 0;   ///< Index in tracks of the track started last.
+
+    /**
+     * @brief Starts fading a track out, or stops it at once if the fade is zero.
+     */
+    void fadeOut(Track &track, sf::Time fade);
+
+    /**
+     * @brief Applies a track's gain and the master volume to its stream.
+     */
+    void applyVolume(Track &track);
+
+   public:
+    /**
+     * @brief Constructor.
+     * @param pack Asset pack to stream tracks from when it has them; may be closed.
+     * @param config Memory cap, default crossfade and volume.
+     */
+    explicit MusicPlayer(const AssetPack &pack, MusicConfig config = {});
+
+    /**
+     * @brief Crossfades to a track, using the configured crossfade time.
+     * @param path Path of the track, in the asset pack or on disk.
+     * @param loop Whether the track restarts when it ends.
+     * @return False if the track cannot be opened; the current music keeps playing.
+     */
+    bool play(const std::string &path, bool loop = true) { return play(path, config.crossfade, loop); }
+
+    /**
+     * @brief Crossfades to a track. Does nothing if the track is already the current one.
+     * @param fade Time over which the old track fades out and the new one fades in.
+     */
+    bool play(const std::string &path, sf::Time fade, bool loop = true);
+
+    /**
+     * @brief Sets the directory relative track paths are read from when the pack lacks them.
+     */
+    void setAssetRoot(const std::filesystem::path &root) { assetRoot = root; }
+
+    /**
+     * @brief Fades the current track out.
+     */
+    void stop(sf::Time fade);
+
+    /**
+     * @brief Fades the current track out using the configured crossfade time.
+     */
+    void stop() { stop(config.crossfade); }
+
+    /**
+     * @brief Advances fades. Call once per frame.
+     * @param elapsed Time since the last call.
+     */
+    void update(sf::Time elapsed);
+
+    /**
+     * @brief Sets the master music volume in [0, 100].
+     */
+    void setVolume(float volume);
+
+    /**
+     * @brief Gets the master music volume.
+     */
+    float getVolume() const { return config.volume; }
+
+    /**
+     * @brief Gets the path of the current track, empty if none is playing or fading in.
+     */
+    const std::string &getCurrentTrack() const { return tracks[current].path; }
+
+    /**
+     * @brief Gets the decode memory of both streams, bounded by the memory cap.
+     */
+    std::size_t getBufferBytes() const;
+};
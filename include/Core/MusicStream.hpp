@@ -0,0 +1,79 @@
+/**
+ * @file MusicStream.hpp
+ * @brief Declares MusicStream, a sound stream that decodes a track a small chunk at a time.
+ */
+#pragma once
+#include <SFML/Audio.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <vector>
+
+/**
+ * @class MusicStream
+ * @brief Plays a compressed or uncompressed track without decoding it all up front.
+ *
+ * Unlike sf::SoundBuffer, which holds every sample of a file, the stream
+ * keeps one fixed decode buffer and refills it from the file as the audio
+ * device asks for more. The buffer is allocated once, when the stream is
+ * constructed, so memory stays flat however long the track is. SFML queues a
+ * few chunks ahead of the device, so the audio memory of a stream is a small
+ * multiple of its buffer size.
+ *
+ * A stream can be reopened with another track after it is stopped; it does
+ * not reallocate when doing so.
+ */
+class MusicStream : public sf::SoundStream {
+   private:
+    sf::InputSoundFile file;              ///< Decoder of the open track.
+    std::vector<std::int16_t> buffer;     ///< Decoded samples handed to SFML; never grows.
+    std::size_t chunkSamples = 0;         ///< Samples decoded per chunk; a multiple of the channel count.
+    std::uint64_t samplesDecoded = 0;     ///< Samples decoded since the last open or seek.
+    mutable std::mutex mutex;             ///< Guards file; SFML pulls data from its own thread.
+
+    /**
+     * @brief Sets the stream up for the track just opened in file.
+     */
+    bool start();
+
+   protected:
+    bool onGetData(Chunk &data) override;
+    void onSeek(sf::Time timeOffset) override;
+
+   public:
+    /**
+     * @brief Constructor.
+     * @param bufferBytes Size of the decode buffer, the stream's share of the music memory cap.
+     */
+    explicit MusicStream(std::size_t bufferBytes);
+
+    /**
+     * @brief Destructor. Stops playback before the decoder goes away.
+     */
+    ~MusicStream() override;
+
+    /**
+     * @brief Opens a track from a file, stopping the current one.
+     * @return False if the file cannot be decoded.
+     */
+    bool openFromFile(const std::filesystem::path &path);
+
+    /**
+     * @brief Opens a track from memory, stopping the current one.
+     * @param data Encoded track; must stay valid until another track is opened.
+     * @return False if the data cannot be decoded.
+     */
+    bool openFromMemory(std::span<const std::byte> data);
+
+    /**
+     * @brief Gets the bytes of the decode buffer.
+     */
+    std::size_t getBufferBytes() const { return buffer.capacity() * sizeof(std::int16_t); }
+
+    /**
+     * @brief Gets the number of samples decoded since the track was opened or sought.
+     */
+    std::uint64_t getSamplesDecoded() const;
+};
@@ -0,0 +1,36 @@
+/**
+ * @file NullRenderTarget.hpp
+ * @brief Declares NullRenderTarget, a render target that discards everything drawn to it.
+ */
+#pragma once
+#include <SFML/Graphics.hpp>
+
+/**
+ * @class NullRenderTarget
+ * @brief Render target without any OpenGL context behind it.
+ *
+ * It has a size and a view, so coordinate mapping works as it would on a real
+ * window, but it never activates: sf::RenderTarget skips every clear and draw
+ * call. Scenes still build their drawables, which makes it suitable for
+ * measuring simulation and scene-graph cost on machines without a display.
+ */
+class NullRenderTarget : public sf::RenderTarget {
+   private:
+    sf::Vector2u size; ///< Reported size in pixels.
+
+   public:
+    /**
+     * @brief Constructs a null target of the given size.
+     * @param size Size reported to scenes and used for the default view.
+     */
+    explicit NullRenderTarget(sf::Vector2u size) : size{size} { initialize(); }
+    /**
+     * @brief Gets the size given at construction.
+     */
+    sf::Vector2u getSize() const override { return size; }
+    /**
+     * @brief Refuses activation so that nothing reaches OpenGL.
+     * @return Always false.
+     */
+    bool setActive(bool = true) override { return false; }
+};
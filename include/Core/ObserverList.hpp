@@ -0,0 +1,232 @@
+/**
+ * @file ObserverList.hpp
+ * @brief Declares the ObserverList container and SubscriptionHandle used by the input states.
+ *
+ * ObserverList keeps its observers in one contiguous vector so dispatching is a
+ * linear scan. Subscribing or unsubscribing while a dispatch is running is
+ * deferred until the outermost dispatch finishes, so callbacks may freely
+ * (un)subscribe themselves or others.
+ */
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct SubscriptionHandle
+ * @brief Identifies one subscription for O(1) removal.
+ *
+ * A handle stays safe to use after its subscription is gone: the generation
+ * counter makes stale handles fail validation instead of removing whoever
+ * reused the slot.
+ */
+struct SubscriptionHandle {
+    static constexpr std::uint32_t INVALID = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t list = INVALID;    ///< Index of the observer list inside its owning state.
+    std::uint32_t slot = INVALID;    ///< Slot inside that list.
+    std::uint32_t generation = 0;    ///< Generation of the slot when the handle was issued.
+    /**
+     * @brief Checks whether the handle was ever issued.
+     */
+    bool isValid() const { return slot != INVALID; }
+};
+
+/**
+ * @class ObserverList
+ * @brief Contiguous list of observer pointers with deferred modification and handle-based removal.
+ * @tparam Observer The observer interface type.
+ */
+template <typename Observer>
+class ObserverList {
+   private:
+    static constexpr std::uint32_t FREE = std::numeric_limits<std::uint32_t>::max();
+    static constexpr std::uint32_t PENDING = FREE - 1;
+
+    /**
+     * @brief Maps a stable slot to the observer's current position in the dense vector.
+     */
+    struct Slot {
+        std::uint32_t position;
+        std::uint32_t generation;
+    };
+
+    std::vector<Observer *> observers;   ///< Dense observers, nullptr marks a deferred removal.
+    std::vector<std::uint32_t> slotOf;   ///< Slot owning each dense position.
+    std::vector<Slot> slots;             ///< Slot table indexed by handle slot.
+    std::vector<std::uint32_t> freeSlots;  ///< Recycled slot indices.
+    std::vector<std::pair<Observer *, std::uint32_t>> pendingAdds;  ///< Adds made during dispatch.
+    int dispatchDepth = 0;               ///< Number of nested dispatches in progress.
+    bool hasPendingRemovals = false;     ///< Whether observers contains nullptr holes.
+
+    std::uint32_t allocateSlot() {
+        if (!freeSlots.empty()) {
+            std::uint32_t slot = freeSlots.back();
+            freeSlots.pop_back();
+            return slot;
+        }
+        slots.push_back({FREE, 0});
+        return static_cast<std::uint32_t>(slots.size() - 1);
+    }
+
+    void releaseSlot(std::uint32_t slot) {
+        slots[slot].position = FREE;
+        slots[slot].generation++;
+        freeSlots.push_back(slot);
+    }
+
+    void append(Observer *observer, std::uint32_t slot) {
+        slots[slot].position = static_cast<std::uint32_t>(observers.size());
+        observers.push_back(observer);
+        slotOf.push_back(slot);
+    }
+
+    void eraseAt(std::uint32_t position) {
+        std::uint32_t slot = slotOf[position];
+        if (dispatchDepth > 0) {
+            observers[position] = nullptr;
+            hasPendingRemovals = true;
+        } else {
+            observers[position] = observers.back();
+            slotOf[position] = slotOf.back();
+            slots[slotOf[position]].position = position;
+            observers.pop_back();
+            slotOf.pop_back();
+        }
+        releaseSlot(slot);
+    }
+
+    void erasePending(std::uint32_t slot) {
+        for (auto it = pendingAdds.begin(); it != pendingAdds.end(); it++) {
+            if (it->second != slot) continue;
+            pendingAdds.erase(it);
+            break;
+        }
+        releaseSlot(slot);
+    }
+
+    /**
+     * @brief Applies modifications deferred during dispatch, preserving dispatch order.
+     */
+    void flush() {
+        if (hasPendingRemovals) {
+            std::uint32_t write = 0;
+            for (std::uint32_t read = 0; read < observers.size(); read++) {
+                if (observers[read] == nullptr) continue;
+                observers[write] = observers[read];
+                slotOf[write] = slotOf[read];
+                slots[slotOf[write]].position = write;
+                write++;
+            }
+            observers.resize(write);
+            slotOf.resize(write);
+            hasPendingRemovals = false;
+        }
+        for (auto [observer, slot] : pendingAdds) append(observer, slot);
+        pendingAdds.clear();
+    }
+
+   public:
+    /**
+     * @brief Adds an observer. Takes effect after the current dispatch, if any.
+     * @param observer Observer to add.
+     * @return Handle whose list field is left for the owning state to fill in.
+     */
+    SubscriptionHandle add(Observer *observer) {
+        std::uint32_t slot = allocateSlot();
+        if (dispatchDepth > 0) {
+            slots[slot].position = PENDING;
+            pendingAdds.push_back({observer, slot});
+        } else {
+            append(observer, slot);
+        }
+        return {SubscriptionHandle::INVALID, slot, slots[slot].generation};
+    }
+
+    /**
+     * @brief Removes the subscription identified by a handle in O(1).
+     * @return False if the handle is stale or does not belong to this list.
+     */
+    bool remove(const SubscriptionHandle &handle) {
+        if (handle.slot >= slots.size()) return false;
+        const Slot &slot = slots[handle.slot];
+        if (slot.generation != handle.generation || slot.position == FREE)
+            return false;
+        if (slot.position == PENDING)
+            erasePending(handle.slot);
+        else
+            eraseAt(slot.position);
+        return true;
+    }
+
+    /**
+     * @brief Removes an observer by pointer (linear search).
+     * @return False if the observer is not subscribed.
+     */
+    bool remove(Observer *observer) {
+        for (std::uint32_t position = 0; position < observers.size(); position++) {
+            if (observers[position] != observer) continue;
+            eraseAt(position);
+            return true;
+        }
+        for (auto [pendingObserver, slot] : pendingAdds) {
+            if (pendingObserver != observer) continue;
+            erasePending(slot);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Checks whether an observer is subscribed, including pending adds.
+     */
+    bool contains(const Observer *observer) const {
+        for (const Observer *current : observers)
+            if (current == observer) return true;
+        for (auto [pendingObserver, slot] : pendingAdds)
+            if (pendingObserver == observer) return true;
+        return false;
+    }
+
+    /**
+     * @brief Removes every observer.
+     */
+    void clear() {
+        while (!pendingAdds.empty()) erasePending(pendingAdds.back().second);
+        for (std::uint32_t position = static_cast<std::uint32_t>(observers.size());
+             position-- > 0;)
+            if (observers[position] != nullptr) eraseAt(position);
+    }
+
+    /**
+     * @brief Calls a function on every observer, in subscription order.
+     *
+     * Observers removed during the call are skipped; observers added during the
+     * call are first notified by the next dispatch. Never allocates.
+     */
+    template <typename Function>
+    void forEach(Function &&function) {
+        dispatchDepth++;
+        const std::size_t count = observers.size();
+        for (std::size_t position = 0; position < count; position++)
+            if (Observer *observer = observers[position]) function(observer);
+        if (--dispatchDepth == 0 && (hasPendingRemovals || !pendingAdds.empty()))
+            flush();
+    }
+
+    /**
+     * @brief Checks whether there is nothing to dispatch to, in constant time.
+     */
+    bool empty() const { return observers.empty() && pendingAdds.empty(); }
+
+    /**
+     * @brief Gets the number of active observers.
+     */
+    std::size_t size() const {
+        std::size_t count = pendingAdds.size();
+        for (const Observer *observer : observers)
+            if (observer != nullptr) count++;
+        return count;
+    }
+};
@@ -0,0 +1,140 @@
+/**
+ * @file RenderQueue.hpp
+ * @brief Declares RenderQueue, which batches textured quads into as few draw calls as possible.
+ */
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Core/AssetRegistry.hpp"
+
+class EntityStore;
+class ResourceManager;
+struct SpriteFrame;
+
+/**
+ * @struct RenderStats
+ * @brief Counters of the last RenderQueue::flush().
+ */
+struct RenderStats {
+    std::size_t quads = 0;         ///< Quads submitted during the frame.
+    std::size_t drawCalls = 0;     ///< Draw calls issued.
+    std::size_t vertices = 0;      ///< Vertices sent to the target.
+    std::size_t skippedQuads = 0;  ///< Quads whose texture was unloaded, or dropped as over the limit.
+};
+
+/**
+ * @class RenderQueue
+ * @brief Collects a frame's quads, sorts them, and draws one vertex batch per texture run.
+ *
+ * Quads are transformed to target space when they are submitted and stored
+ * in a reusable array. flush() sorts them by layer, then texture, then
+ * submission order, and issues one draw call per run of quads sharing a
+ * texture, so a layer full of sprites from one atlas costs a single call no
+ * matter how many sprites it holds. Runs continue across layers when the
+ * texture does not change.
+ *
+ * Draw order is only guaranteed between layers and, within a layer, between
+ * quads of the same texture. Sprites of different textures that overlap must
+ * be placed on different layers.
+ *
+ * Textures are resolved when the queue is flushed, so a texture unloaded
+ * mid-frame is skipped rather than dangling.
+ */
+class RenderQueue {
+   private:
+    static constexpr unsigned INDEX_BITS = 24;    ///< Bits of a sort key holding the quad index.
+    static constexpr unsigned TEXTURE_BITS = 24;  ///< Bits of a sort key holding the texture slot.
+
+    /**
+     * @struct Quad
+     * @brief A submitted quad, already in target space.
+     */
+    struct Quad {
+        TextureHandle texture;        ///< Texture to sample; invalid for an untextured quad.
+        sf::Vector2f corners[4];      ///< Top left, top right, bottom left, bottom right.
+        sf::FloatRect textureRect;    ///< Texture region, in pixels.
+        sf::Color color;              ///< Tint of every vertex.
+    };
+
+    const ResourceManager &resources;  ///< Resolves texture handles at flush time.
+    std::vector<Quad> quads;           ///< Quads of the current frame, in submission order.
+    std::vector<std::uint64_t> keys;   ///< Sort key of every quad: layer, texture slot, quad index.
+    std::vector<sf::Vertex> vertices;  ///< Triangle list of the frame, reused between frames.
+    RenderStats stats;                 ///< Counters of the last flush.
+    std::size_t dropped = 0;           ///< Quads refused this frame because the queue was full.
+
+    /**
+     * @brief Stores a quad and its sort key.
+     */
+    void push(TextureHandle texture, const sf::Vector2f (&corners)[4], sf::IntRect textureRect,
+              sf::Color color, std::int16_t layer);
+
+   public:
+    static constexpr std::size_t MAX_QUADS = std::size_t{1} << INDEX_BITS;  ///< Quads accepted per frame.
+
+    /**
+     * @brief Constructor.
+     * @param resources Resource manager owning the textures quads refer to.
+     */
+    explicit RenderQueue(const ResourceManager &resources) : resources(resources) {}
+
+    /**
+     * @brief Reserves room for a number of quads so submission does not reallocate.
+     */
+    void reserve(std::size_t quadCount);
+
+    /**
+     * @brief Submits a transformed quad.
+     * @param texture Texture to sample, or an invalid handle for a flat colored quad.
+     * @param transform Transform from the quad's local space, whose size is textureRect's size.
+     * @param textureRect Texture region, in pixels.
+     * @param color Tint.
+     * @param layer Draw order; lower layers are drawn first.
+     */
+    void submit(TextureHandle texture, const sf::Transform &transform, sf::IntRect textureRect,
+                sf::Color color = sf::Color::White, std::int16_t layer = 0);
+
+    /**
+     * @brief Submits an axis-aligned, unscaled quad; cheaper than the transform overload.
+     * @param position Target position of the quad's top left corner.
+     */
+    void submit(TextureHandle texture, sf::Vector2f position, sf::IntRect textureRect,
+                sf::Color color = sf::Color::White, std::int16_t layer = 0);
+
+    /**
+     * @brief Submits an atlas sprite at a position, see ResourceManager::getSprite().
+     */
+    void submit(const SpriteFrame &sprite, sf::Vector2f position, sf::Color color = sf::Color::White,
+                std::int16_t layer = 0);
+
+    /**
+     * @brief Submits every entity with a position and a sprite at its interpolated position.
+     * @param alpha Interpolation alpha in [0, 1].
+     */
+    void submit(const EntityStore &entities, float alpha);
+
+    /**
+     * @brief Draws and discards every submitted quad, updating the stats.
+     * @param target Target to draw to.
+     * @param states States applied to every batch; its texture is replaced per batch.
+     */
+    void flush(sf::RenderTarget &target, sf::RenderStates states = sf::RenderStates::Default);
+
+    /**
+     * @brief Discards every submitted quad without drawing.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the number of quads submitted since the last flush.
+     */
+    std::size_t size() const { return quads.size(); }
+
+    /**
+     * @brief Gets the counters of the last flush.
+     */
+    const RenderStats &getStats() const { return stats; }
+};
@@ -0,0 +1,89 @@
+/**
+ * @file RenderSnapshot.hpp
+ * @brief Declares RenderSnapshot, everything the render thread needs to draw one simulation tick.
+ */
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Core/AssetRegistry.hpp"
+
+class EntityStore;
+class RenderQueue;
+class ResourceManager;
+
+/**
+ * @struct SnapshotSprite
+ * @brief A sprite with its position at the last two ticks.
+ */
+struct SnapshotSprite {
+    TextureHandle texture;          ///< Texture to sample.
+    sf::IntRect textureRect;        ///< Region of the texture.
+    sf::Vector2f previous;          ///< Top left corner at the previous tick.
+    sf::Vector2f current;           ///< Top left corner at the published tick.
+    sf::Color color;                ///< Tint.
+    std::int16_t layer;             ///< Draw order; lower layers are drawn first.
+};
+
+/**
+ * @struct SnapshotText
+ * @brief A UI label, drawn above every sprite.
+ */
+struct SnapshotText {
+    FontHandle font;                ///< Font to render with.
+    std::string string;             ///< Text of the label.
+    sf::Vector2f position;          ///< Top left corner.
+    unsigned size;                  ///< Character size in pixels.
+    sf::Color color;                ///< Fill color.
+};
+
+/**
+ * @struct RenderSnapshot
+ * @brief Immutable description of a scene at one tick, published by the simulation thread.
+ *
+ * Holds values and handles only, never pointers into scene state, so the
+ * render thread can draw it while the simulation runs the next tick.
+ * Positions of the last two ticks are kept so the render thread interpolates
+ * at its own rate. clear() keeps the allocations, so a snapshot reused
+ * through a TripleBuffer stops allocating once it has seen a busy tick.
+ */
+struct RenderSnapshot {
+    std::uint64_t tick = 0;                  ///< Simulation tick the snapshot was taken at.
+    sf::Color clearColor = sf::Color::Black; ///< Background color.
+    std::vector<SnapshotSprite> sprites;     ///< World sprites.
+    std::vector<SnapshotText> texts;         ///< UI labels.
+
+    /**
+     * @brief Empties the snapshot, keeping its capacity.
+     */
+    void clear();
+
+    /**
+     * @brief Adds a sprite that did not move since the previous tick.
+     */
+    void addSprite(TextureHandle texture, sf::IntRect textureRect, sf::Vector2f position,
+                   sf::Color color = sf::Color::White, std::int16_t layer = 0) {
+        sprites.push_back({texture, textureRect, position, position, color, layer});
+    }
+
+    /**
+     * @brief Adds every entity with a position and a sprite, with both its positions.
+     */
+    void addEntities(const EntityStore &entities);
+
+    /**
+     * @brief Adds a UI label.
+     */
+    void addText(FontHandle font, std::string string, sf::Vector2f position, unsigned size = 24,
+                 sf::Color color = sf::Color::White) {
+        texts.push_back({font, std::move(string), position, size, color});
+    }
+
+    /**
+     * @brief Draws the sprites through a render queue, then the labels.
+     * @param alpha Interpolation alpha in [0, 1] between the previous and published tick.
+     */
+    void draw(sf::RenderTarget &target, RenderQueue &queue, const ResourceManager &resources, float alpha) const;
+};
@@ -6,60 +6,300 @@
 
 #include <SFML/Audio.hpp>
 #include <SFML/Graphics.hpp>
-#include <list>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <future>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
 #include <string>
+#include <utility>
+
+#include "Core/AssetPack.hpp"
+#include "Core/AssetRegistry.hpp"
+#include "Core/MusicPlayer.hpp"
+#include "Core/SoundPool.hpp"
+#include "Utility/StringId.hpp"
+#include "Utility/ThreadPool.hpp"
+
+/**
+ * @struct LoadProgress
+ * @brief Progress of the current batch of asynchronous loads.
+ *
+ * A batch starts with the first load requested while nothing is pending and
+ * ends when every asset requested since then is available or has failed.
+ */
+struct LoadProgress {
+    std::size_t requested = 0; ///< Assets requested in the current batch.
+    std::size_t finished = 0;  ///< Assets finished, successfully or not.
+    std::size_t failed = 0;    ///< Assets that could not be loaded.
+    /**
+     * @brief Gets the finished fraction in [0, 1]; 1 when nothing was requested.
+     */
+    float getFraction() const {
+        return requested == 0 ? 1.f : static_cast<float>(finished) / requested;
+    }
+    /**
+     * @brief Checks whether every requested asset has finished.
+     */
+    bool isDone() const { return finished == requested; }
+};
+
+/**
+ * @struct SpriteFrame
+ * @brief Where a sprite lives: an atlas page and the region of it.
+ */
+struct SpriteFrame {
+    TextureHandle texture;  ///< Atlas page holding the sprite.
+    sf::IntRect rect;       ///< Region of the page, in pixels.
+};
+
 /**
  * @class ResourceManager
  * @brief Manages loading, storing, and accessing game resources such as textures, sounds, and fonts.
+ *
+ * Each asset is interned under its ID once, when it finishes loading. Hot
+ * code should resolve the ID to a handle once (e.g. with "coin"_sid) and keep
+ * the handle; the string overloads are meant for tools and setup code.
+ *
+ * Assets can be loaded synchronously or in the background. Background loads
+ * decode files on a worker pool; the decoded data is handed back to the main
+ * thread by finishUploads(), which also uploads textures to the GPU, so all
+ * resource maps are only ever changed by the main thread. A render thread may
+ * still read textures and fonts, see setDrawMutex().
  */
 class ResourceManager {
+   public:
+    /**
+     * @brief Kind of asset a background load produces.
+     */
+    enum class AssetKind { Texture, Sound, Font };
+
    private:
-    std::map<std::string, std::unique_ptr<sf::Texture>> textures; ///< Loaded textures.
-    std::map<std::string, std::unique_ptr<sf::SoundBuffer>> soundBuffers; ///< Loaded sound buffers.
-    std::map<std::string, std::unique_ptr<sf::Font>> fonts; ///< Loaded fonts.
-    std::list<std::unique_ptr<sf::Sound>> playingSounds; ///< Currently playing sounds.
+
+    /**
+     * @struct DecodedAsset
+     * @brief Result of a worker decode, waiting for the main thread.
+     */
+    struct DecodedAsset {
+        AssetKind kind;                            ///< Which map the asset goes into.
+        std::string ID;                            ///< Key requested by the caller.
+        std::string path;                          ///< Source file, for error messages.
+        std::span<const std::byte> packed;         ///< Contents in the mounted pack; null to read file.
+        std::filesystem::path file;                ///< path under the asset root, read when not packed.
+        std::size_t sourceBytes = 0;               ///< Size of the encoded file, the estimate until decoded.
+        bool cancelled = false;                    ///< Set by cancelLoad(); main thread only.
+        std::unique_ptr<sf::Image> image;          ///< Decoded pixels of a texture.
+        std::unique_ptr<sf::SoundBuffer> sound;    ///< Decoded sound samples.
+        std::unique_ptr<sf::Font> font;            ///< Opened font face.
+        std::promise<bool> promise;                ///< Fulfilled once the asset is usable.
+    };
+
+    /**
+     * @struct DecodeQueue
+     * @brief Decoded assets shared between the workers and the main thread.
+     */
+    struct DecodeQueue {
+        std::mutex mutex;                          ///< Guards ready.
+        std::deque<std::shared_ptr<DecodedAsset>> ready; ///< Decoded, not yet handed over.
+    };
+
+    AssetPack pack; ///< Mounted archive; declared first so it outlives the fonts reading from it.
+    std::filesystem::path assetRoot; ///< Prefix of loose-file paths, see setAssetRoot().
+    AssetRegistry<sf::Texture, TextureTag> textures; ///< Loaded textures.
+    AssetRegistry<sf::SoundBuffer, SoundTag> soundBuffers; ///< Loaded sound buffers.
+    AssetRegistry<sf::Font, FontTag> fonts; ///< Loaded fonts.
+    AssetRegistry<SpriteFrame, SpriteTag> sprites; ///< Sprites of loaded atlases.
+    SoundPool soundPool; ///< Voices playSound() plays on; declared after soundBuffers so it stops first.
+    MusicPlayer musicPlayer; ///< Streamed music; declared after pack so it stops before the pack unmaps.
+    std::map<std::pair<AssetKind, std::string>, std::shared_ptr<DecodedAsset>> pendingLoads; ///< Background loads still in flight.
+    LoadProgress progress; ///< Progress of the current batch.
+    std::unique_ptr<DecodeQueue> decodeQueue; ///< Outlives loaderPool, see member order.
+    std::unique_ptr<ThreadPool> loaderPool; ///< Created by the first background load.
+    std::shared_mutex *drawMutex = nullptr; ///< Guards textures and fonts against a render thread, see setDrawMutex().
 
     ResourceManager(const ResourceManager &rhs) = delete;
     ResourceManager operator=(const ResourceManager &rhs) = delete;
 
     /**
-     * @brief Removes sounds from the playingSounds list that have finished playing.
+     * @brief Finds a file in the mounted pack.
+     * @return View of its contents, or a null view if there is no pack or no such file.
+     */
+    std::span<const std::byte> findPacked(const std::string &path) const;
+
+    /**
+     * @brief Gets where a path not found in the pack lives on disk.
+     */
+    std::filesystem::path getDiskPath(const std::string &path) const { return assetRoot / path; }
+
+    /**
+     * @brief Locks the draw mutex exclusively, if there is one, for one change to textures or fonts.
+     */
+    std::unique_lock<std::shared_mutex> lockDrawn() {
+        return drawMutex != nullptr ? std::unique_lock<std::shared_mutex>(*drawMutex)
+                                    : std::unique_lock<std::shared_mutex>();
+    }
+
+    /**
+     * @brief Queues a background decode and registers it with the current batch.
+     * @return Future fulfilled by finishUploads() once the asset is usable.
      */
-    void freeSound();
+    std::future<bool> queueLoad(AssetKind kind, const std::string &path, const std::string &ID);
+
+    /**
+     * @brief Moves one decoded asset into its map, uploading textures to the GPU.
+     */
+    void finishLoad(DecodedAsset &asset);
 
    public:
     /**
      * @brief Default constructor.
      */
-    ResourceManager() = default;
+    ResourceManager();
+
+    /**
+     * @brief Not movable: the music player refers to the manager's own pack.
+     */
+    ResourceManager(ResourceManager &&rhs) = delete;
+
+    /**
+     * @brief Serves later loads from a pack archive written by the AssetPacker tool.
+     *
+     * Once a pack is mounted, every load whose path names a file of the pack
+     * decodes it straight from the memory mapping; other paths still load from
+     * disk. The pack stays mapped until the manager is destroyed, since fonts
+     * keep reading from it.
+     *
+     * @param path Path to the .pack archive.
+     * @return False if a pack is already mounted or the file is not a valid pack.
+     */
+    bool mountPack(const std::string &path);
+
+    /**
+     * @brief Checks whether a pack is mounted.
+     */
+    bool isPackMounted() const { return pack.isOpen(); }
 
     /**
-     * @brief Move constructor.
+     * @brief Sets the directory relative paths are read from when the pack lacks them.
+     *
+     * Pack lookups keep using the path as given. Defaults to empty, which
+     * resolves against the working directory.
+     * @param root Directory holding the loose assets, usually the executable's.
      */
-    ResourceManager(ResourceManager &&rhs) noexcept = default;
+    void setAssetRoot(const std::filesystem::path &root);
+
+    /**
+     * @brief Lets another thread draw from the textures and fonts while this one loads and unloads.
+     *
+     * Every insertion into or removal from the texture and font maps then
+     * holds mutex exclusively for just that change; decoding, GPU uploads and
+     * the caller's own work run unlocked. The drawing thread holds mutex shared
+     * while it resolves handles and draws, and must not touch anything else.
+     * @param mutex Mutex shared with the drawing thread, or nullptr to stop locking; must outlive its use here.
+     */
+    void setDrawMutex(std::shared_mutex *mutex) { drawMutex = mutex; }
 
     /**
      * @brief Loads a sound buffer from file and stores it with the given ID.
      * @param path Path to the sound file.
      * @param ID Key to identify the loaded sound buffer.
+     * @return Handle to the sound buffer, invalid if loading failed or the ID is taken.
      */
-    void loadSound(const std::string &path, const std::string &ID);
+    SoundHandle loadSound(const std::string &path, const std::string &ID);
 
     /**
      * @brief Loads a texture from file and stores it with the given ID.
      * @param path Path to the texture file.
      * @param ID Key to identify the loaded texture.
+     * @return Handle to the texture, invalid if loading failed or the ID is taken.
+     */
+    TextureHandle loadTexture(const std::string &path, const std::string &ID);
+
+    /**
+     * @brief Loads a texture atlas written by the AtlasPacker tool.
+     *
+     * Every page is loaded as a texture whose ID is the page path, and every
+     * sprite of the manifest becomes available through getSprite() under its
+     * name. Prefer this over one loadTexture() per image: it loads a few large
+     * textures, and sprites sharing a page are drawn in one batch.
+     *
+     * @param manifestPath Path to the .atlas manifest.
+     * @return Number of sprites registered; 0 if the manifest or a page failed to load.
      */
-    void loadTexture(const std::string &path, const std::string &ID);
+    std::size_t loadAtlas(const std::string &manifestPath);
 
     /**
      * @brief Loads a font from file and stores it with the given ID.
      * @param path Path to the font file.
      * @param ID Key to identify the loaded font.
+     * @return Handle to the font, invalid if loading failed or the ID is taken.
+     */
+    FontHandle loadFont(const std::string &path, const std::string &ID);
+
+    /**
+     * @brief Decodes a sound buffer on a worker thread.
+     * @param path Path to the sound file.
+     * @param ID Key to identify the loaded sound buffer.
+     * @return Future set to whether loading succeeded, once finishUploads() has
+     * made the sound available. Do not wait on it without calling finishUploads().
+     */
+    std::future<bool> loadSoundAsync(const std::string &path, const std::string &ID);
+
+    /**
+     * @brief Decodes an image on a worker thread; finishUploads() turns it into a texture.
+     * @param path Path to the image file.
+     * @param ID Key to identify the loaded texture.
+     * @return Future set to whether loading succeeded, see loadSoundAsync().
+     */
+    std::future<bool> loadTextureAsync(const std::string &path, const std::string &ID);
+
+    /**
+     * @brief Opens a font on a worker thread.
+     * @param path Path to the font file.
+     * @param ID Key to identify the loaded font.
+     * @return Future set to whether loading succeeded, see loadSoundAsync().
      */
-    void loadFont(const std::string &path, const std::string &ID);
+    std::future<bool> loadFontAsync(const std::string &path, const std::string &ID);
+
+    /**
+     * @brief Makes decoded background loads available. Call once per frame on the main thread.
+     *
+     * Texture uploads are the expensive part, so work stops once the budget is
+     * spent; at least one asset is always finished so loading cannot stall.
+     *
+     * @param budget Time this call may spend.
+     * @return Number of assets finished by this call.
+     */
+    std::size_t finishUploads(sf::Time budget);
+
+    /**
+     * @brief Gets the progress of the current batch of background loads.
+     */
+    const LoadProgress &getLoadProgress() const { return progress; }
+
+    /**
+     * @brief Checks whether an ID is loaded or being loaded for a given asset kind.
+     */
+    bool isKnownID(AssetKind kind, const std::string &ID) const;
+
+    /**
+     * @brief Abandons a background load that has not finished yet.
+     *
+     * The ID is free again at once. When the decode lands, finishUploads()
+     * drops it and fulfils the future with false; it counts as finished, not failed.
+     * @return False if no load of that ID is in flight.
+     */
+    bool cancelLoad(AssetKind kind, const std::string &ID);
+
+    /**
+     * @brief Estimates the memory a background load will hold: its encoded size until it finishes.
+     * @return Bytes, 0 if no load of that ID is in flight.
+     */
+    std::size_t getPendingMemoryUsage(AssetKind kind, const std::string &ID) const;
 
     /**
      * @brief Destructor. Frees all loaded fonts, sound buffers, and textures.
@@ -69,8 +309,28 @@ class ResourceManager {
     /**
      * @brief Plays a sound by ID. The sound buffer must be loaded first.
      * @param ID Key of the sound buffer to play.
+     * @param params Volume, pitch and priority of this playback.
+     * @return Handle to the playback, invalid if the sound is unknown or was dropped.
+     */
+    VoiceHandle playSound(const std::string &ID, const SoundParams &params = {});
+
+    /**
+     * @brief Plays a sound by handle.
+     * @param sound Handle of the sound buffer to play.
+     * @param params Volume, pitch and priority of this playback.
+     * @return Handle to the playback, invalid if the handle is stale or the sound was dropped.
+     */
+    VoiceHandle playSound(SoundHandle sound, const SoundParams &params = {});
+
+    /**
+     * @brief Gets the voice pool, to set per-sound caps or stop playbacks.
+     */
+    SoundPool &getSoundPool() { return soundPool; }
+
+    /**
+     * @brief Gets the music player. Music is streamed, never loaded into a sound buffer.
      */
-    void playSound(const std::string &ID);
+    MusicPlayer &getMusicPlayer() { return musicPlayer; }
 
     /**
      * @brief Retrieves a pointer to a loaded texture by ID.
@@ -85,4 +345,75 @@ class ResourceManager {
      * @return Pointer to the font, or nullptr if not found.
      */
     const sf::Font *const getFont(const std::string &ID) const;
+
+    /**
+     * @brief Resolves a texture handle.
+     * @return Pointer to the texture, or nullptr if the handle is stale.
+     */
+    const sf::Texture *getTexture(TextureHandle texture) const { return textures.get(texture); }
+
+    /**
+     * @brief Resolves a font handle.
+     * @return Pointer to the font, or nullptr if the handle is stale.
+     */
+    const sf::Font *getFont(FontHandle font) const { return fonts.get(font); }
+
+    /**
+     * @brief Retrieves a sprite of a loaded atlas by name.
+     * @return Pointer to the sprite frame, or nullptr if not found.
+     */
+    const SpriteFrame *getSprite(const std::string &ID) const;
+
+    /**
+     * @brief Resolves a sprite handle.
+     * @return Pointer to the sprite frame, or nullptr if the handle is stale.
+     */
+    const SpriteFrame *getSprite(SpriteHandle sprite) const { return sprites.get(sprite); }
+
+    /**
+     * @brief Gets the handle of a sprite of a loaded atlas, invalid if there is none.
+     */
+    SpriteHandle getSpriteHandle(StringId ID) const { return sprites.find(ID); }
+
+    /**
+     * @brief Gets the handle of a loaded texture, invalid if there is none.
+     */
+    TextureHandle getTextureHandle(StringId ID) const { return textures.find(ID); }
+
+    /**
+     * @brief Gets the handle of a loaded sound buffer, invalid if there is none.
+     */
+    SoundHandle getSoundHandle(StringId ID) const { return soundBuffers.find(ID); }
+
+    /**
+     * @brief Gets the handle of a loaded font, invalid if there is none.
+     */
+    FontHandle getFontHandle(StringId ID) const { return fonts.find(ID); }
+
+    /**
+     * @brief Estimates the memory held by a texture: four bytes per pixel.
+     * @return Bytes, 0 if the handle is stale.
+     */
+    std::size_t getMemoryUsage(TextureHandle texture) const;
+
+    /**
+     * @brief Estimates the memory held by a sound buffer: two bytes per sample.
+     * @return Bytes, 0 if the handle is stale.
+     */
+    std::size_t getMemoryUsage(SoundHandle sound) const;
+
+    /**
+     * @brief Unloads a texture; its handles become stale.
+     */
+    void unloadTexture(TextureHandle texture);
+
+    /**
+     * @brief Stops the sound's voices and unloads it; its handles become stale.
+     */
+    void unloadSound(SoundHandle sound);
+
+    /**
+     * @brief Unloads a font; its handles become stale.
+     */
+    void unloadFont(FontHandle font);
 };
\ No newline at end of file
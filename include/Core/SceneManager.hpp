@@ -3,63 +3,185 @@
  * @brief Declares the SceneManager class for managing game scenes.
  */
 #pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
 #include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include "Base/Constants.hpp"
+#include "Core/MusicPlayer.hpp"
 #include "Scene/Scene.hpp"
 #include "Utility/exception.hpp"
 #include "Utility/Logger.hpp"
+#include "Utility/ThreadPool.hpp"
 /**
  * @class SceneManager
  * @brief Manages switching, updating, and rendering game scenes.
+ *
+ * Registering a scene only stores a factory; the scene is built the first
+ * time it is entered, or ahead of time on a worker thread by preload().
+ * Scenes that are not current stay resident until the estimated memory of
+ * all resident scenes exceeds the budget, then the least recently used
+ * ones are unloaded (Scene::onUnload() releases their assets), destroyed
+ * and rebuilt if entered again.
+ *
+ * Scenes form a stack: pushScene() lays an overlay such as a pause menu
+ * over the current scene, which is the top of the stack and the only one
+ * receiving input. Scenes below an opaque scene are not drawn at all, and
+ * scenes below one that pauses them are not updated. A paused scene that
+ * shows through a translucent overlay cannot change, so it is drawn once
+ * into a render texture and that texture is drawn from then on.
  */
 class SceneManager {
+   public:
+    /// Builds a scene from the render target and the name it was registered under.
+    using SceneFactory = std::function<std::unique_ptr<Scene>(sf::RenderTarget &, const std::string &)>;
+
    private:
-    Scene *currentScene; ///< Pointer to the current active scene.
-    sf::RenderWindow &window; ///< Reference to the main window.
-    std::unordered_map<std::string, std::unique_ptr<Scene>> sceneStorage; ///< Storage for all registered scenes.
+    /**
+     * @struct SceneEntry
+     * @brief A registered scene, built or not.
+     */
+    struct SceneEntry {
+        SceneFactory factory;                        ///< Builds the scene.
+        std::unique_ptr<Scene> scene;                ///< The scene, null while not resident.
+        std::future<std::unique_ptr<Scene>> pending; ///< Background build started by preload(), if any.
+        std::uint64_t lastUsed = 0;                  ///< Use stamp for least-recently-used eviction.
+    };
+
+    /**
+     * @struct Layer
+     * @brief A scene on the stack, with the cached image of it used while it is paused.
+     */
+    struct Layer {
+        Scene *scene;                         ///< The scene, resident while on the stack.
+        std::unique_ptr<sf::RenderTexture> cache; ///< Last frame of the scene; created when first needed.
+        bool cacheValid = false;              ///< Whether cache holds the scene's current state.
+    };
+
+    Scene *currentScene; ///< Pointer to the current active scene, the top of the stack.
+    std::vector<Layer> stack; ///< Scenes from the bottom up; the last one is currentScene.
+    bool cacheUnavailable = false; ///< Set when a render texture cannot be created; paused scenes are redrawn.
+    sf::RenderTarget &target; ///< Target scenes render into, usually the main window.
+    std::unordered_map<std::string, SceneEntry> sceneStorage; ///< Storage for all registered scenes.
+    MusicPlayer *musicPlayer = nullptr; ///< Plays each scene's music track; scenes are silent without it.
+    SceneContext context; ///< Engine services handed to every scene.
+    std::size_t memoryBudget = GameConstants::SCENE_MEMORY_BUDGET_BYTES; ///< Resident scene memory before eviction.
+    std::uint64_t useClock = 0; ///< Source of SceneEntry::lastUsed stamps.
+    std::size_t evictions = 0; ///< Scenes destroyed to stay within the budget.
+    std::unique_ptr<ThreadPool> loaderPool; ///< Builds preloaded scenes; created by the first preload(), joined first.
    public:
     /**
-     * @brief Constructs a SceneManager for the given window.
-     * @param window Reference to the SFML render window.
+     * @brief Constructs a SceneManager rendering into the given target.
+     * @param target Reference to the main window or an off-screen render target.
+     */
+    SceneManager(sf::RenderTarget &target)
+        : currentScene{nullptr}, target{target} {};
+    /**
+     * @brief Destructor. Calls onUnload() on every resident scene before destroying it.
      */
-    SceneManager(sf::RenderWindow &window)
-        : currentScene{nullptr}, window{window} {};
+    ~SceneManager();
     /**
-     * @brief Registers a new scene type with a given name.
+     * @brief Registers a new scene type with a given name. The scene is not built yet.
      * @tparam SceneType The type of the scene to register.
      * @param sceneName The name to register the scene under.
      */
     template <typename SceneType>
     void registerScene(const std::string &sceneName) {
-        try {
-            if (sceneStorage.find(sceneName) == sceneStorage.end()) {
-                sceneStorage[sceneName] =
-                    std::make_unique<SceneType>(window, sceneName);
-            } else {
-                Logger::error(
-                    "Name conflict: Inserting a duplicate scene label");
-            }
-        } catch (...) {
-            Logger::critical(
-                "Inserting an object that is not a subclass of Scene");
-        }
-        return;
+        static_assert(std::is_base_of_v<Scene, SceneType>, "Registered scenes must derive from Scene");
+        registerScene(sceneName, [](sf::RenderTarget &target, const std::string &name) -> std::unique_ptr<Scene> {
+            return std::make_unique<SceneType>(target, name);
+        });
     }
+    /**
+     * @brief Registers a factory that builds the scene with a given name.
+     * @param sceneName The name to register the scene under.
+     * @param factory Called when the scene is needed, possibly on a worker thread.
+     */
+    void registerScene(const std::string &sceneName, SceneFactory factory);
+    /**
+     * @brief Starts building a scene on a worker thread, ahead of a changeScene() to it.
+     *
+     * The scene is finished (context set, onLoad() called) by the next
+     * update(), or by changeScene() if that comes first, which then waits
+     * for the build. Does nothing if the scene is resident or already loading.
+     *
+     * @param sceneName The name of the scene to build.
+     * @return False if no scene has that name.
+     */
+    bool preload(const std::string &sceneName);
+    /**
+     * @brief Checks whether a scene is built and resident.
+     */
+    bool isLoaded(const std::string &sceneName) const;
+    /**
+     * @brief Sets how much memory resident scenes may hold before inactive ones are evicted.
+     * @param bytes Budget, compared with the sum of Scene::getMemoryUsage(); the current scene is never evicted.
+     */
+    void setMemoryBudget(std::size_t bytes);
+    /**
+     * @brief Gets the estimated memory of all resident scenes.
+     */
+    std::size_t getResidentMemory() const;
+    /**
+     * @brief Gets the number of scenes evicted so far.
+     */
+    std::size_t getEvictionCount() const { return evictions; }
+    /**
+     * @brief Sets the player that crossfades to a scene's music track when the scene becomes current.
+     * @param player Music player, or nullptr to leave music alone.
+     */
+    void setMusicPlayer(MusicPlayer *player) { musicPlayer = player; }
+    /**
+     * @brief Sets the engine services handed to resident scenes and to scenes built later.
+     * @param context Services owned by the game loop.
+     */
+    void setContext(const SceneContext &context);
     /**
      * @brief Changes the current scene to the one with the given name.
+     *
+     * Builds the scene if it is not resident, calls onExit() on the old
+     * scene and onEnter() on the new one, then evicts scenes over the budget.
      * @param sceneName The name of the scene to switch to.
      */
     void changeScene(const std::string &sceneName);
+    /**
+     * @brief Lays a scene over the current one, making it current. The scenes below keep their state.
+     * @param sceneName The name of the scene to push; it must not be on the stack already.
+     */
+    void pushScene(const std::string &sceneName);
+    /**
+     * @brief Removes the current scene, making the one below it current again.
+     */
+    void popScene();
+    /**
+     * @brief Gets the number of scenes on the stack.
+     */
+    std::size_t getStackSize() const { return stack.size(); }
     /**
      * @brief Gets a const reference to the current scene pointer.
      * @return Const reference to the current scene pointer.
      */
     const Scene* const &getCurrentScene() { return currentScene; };
     /**
-     * @brief Renders the current scene.
+     * @brief Renders the visible scenes of the stack, bottom up.
+     * @param alpha Interpolation alpha between the last two ticks, in [0, 1).
      */
-    void render();
+    void render(float alpha);
     /**
-     * @brief Updates the current scene.
+     * @brief Describes the visible scenes of the stack for the render thread.
+     * @param snapshot Cleared snapshot to fill.
+     */
+    void snapshot(RenderSnapshot &snapshot);
+    /**
+     * @brief Finishes preloaded scenes, then advances the scenes that are not paused by one fixed tick.
+     *
+     * Each scene runs its subticks first; scenes are updated from the bottom up.
      */
     void update();
     /**
@@ -77,4 +199,42 @@ class SceneManager {
      * @brief Checks if the current scene pointer is null and throws if so.
      */
     void checkNullptr();
+    /**
+     * @brief Makes a scene resident, waiting for its preload or building it here.
+     * @return The scene, or nullptr if its factory failed.
+     */
+    Scene *build(const std::string &sceneName, SceneEntry &entry);
+    /**
+     * @brief Hands a newly built scene its context and lets it queue its assets.
+     */
+    void finishBuild(SceneEntry &entry, std::unique_ptr<Scene> scene);
+    /**
+     * @brief Enters a scene as the new top of the stack and plays its music.
+     */
+    void enter(Scene *scene, SceneEntry &entry);
+    /**
+     * @brief Marks the scene's entry as just used.
+     */
+    void touch(const Scene *scene);
+    /**
+     * @brief Gets the index of the lowest layer that is drawn, the topmost opaque one.
+     */
+    std::size_t firstVisibleLayer() const;
+    /**
+     * @brief Gets the index of the lowest layer that is updated.
+     */
+    std::size_t firstActiveLayer() const;
+    /**
+     * @brief Draws a paused layer from its cached image, rendering the image first if needed.
+     * @return False if no render texture is available, in which case nothing was drawn.
+     */
+    bool drawCached(Layer &layer);
+    /**
+     * @brief Finishes preloads whose build is done.
+     */
+    void finishPreloads();
+    /**
+     * @brief Destroys least recently used scenes off the stack until resident memory fits the budget.
+     */
+    void evictOverBudget();
 };
\ No newline at end of file
@@ -0,0 +1,184 @@
+/**
+ * @file SoundPool.hpp
+ * @brief Declares SoundPool, a fixed set of reusable sound voices with voice stealing.
+ */
+#pragma once
+#include <SFML/Audio.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "Utility/StringId.hpp"
+
+/**
+ * @enum VoiceStealPolicy
+ * @brief What SoundPool does when a new sound needs a voice and none is free.
+ */
+enum class VoiceStealPolicy {
+    None,            ///< Drop the new sound.
+    Oldest,          ///< Stop the voice that started first.
+    LowestPriority,  ///< Stop the lowest-priority voice, if it is not above the new sound.
+    Quietest         ///< Stop the voice with the lowest volume.
+};
+
+/**
+ * @struct SoundPoolConfig
+ * @brief Construction settings of a SoundPool.
+ */
+struct SoundPoolConfig {
+    std::size_t maxVoices = 32;                           ///< Voices created up front.
+    VoiceStealPolicy stealPolicy = VoiceStealPolicy::Oldest; ///< Policy when all voices are busy.
+};
+
+/**
+ * @struct SoundParams
+ * @brief Per-play settings.
+ */
+struct SoundParams {
+    float volume = 100.f;  ///< Volume in [0, 100].
+    float pitch = 1.f;     ///< Pitch multiplier.
+    int priority = 0;      ///< Higher priorities survive LowestPriority stealing.
+};
+
+/**
+ * @struct VoiceHandle
+ * @brief Identifies one playback; becomes stale once its voice is reused.
+ */
+struct VoiceHandle {
+    static constexpr std::uint32_t INVALID = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t voice = INVALID;  ///< Index of the voice.
+    std::uint32_t generation = 0;   ///< Generation of the voice when the handle was issued.
+    /**
+     * @brief Checks whether the play request got a voice.
+     */
+    bool isValid() const { return voice != INVALID; }
+};
+
+/**
+ * @class SoundPool
+ * @brief Plays sounds on a fixed number of preallocated sf::Sound voices.
+ *
+ * Free voices sit on a free list, so starting a sound is O(1) and does not
+ * allocate once the pool and the sound's ID are set up. Finished voices are
+ * reclaimed by update() or, when the free list runs dry, by play() itself.
+ * When every voice is busy, or a sound ID reaches its concurrency cap, a
+ * voice is stolen according to the configured policy.
+ */
+class SoundPool {
+   private:
+    /**
+     * @brief One reusable playback slot.
+     */
+    struct Voice {
+        std::optional<sf::Sound> sound;  ///< Created once, rebound with setBuffer().
+        std::uint32_t soundID = 0;       ///< Index in idStates of the sound playing.
+        std::uint64_t startOrder = 0;    ///< Play counter value when started.
+        int priority = 0;                ///< Priority given at play time.
+        float volume = 0.f;              ///< Volume given at play time.
+        std::uint32_t generation = 0;    ///< Bumped whenever the voice is released.
+        bool active = false;             ///< Whether the voice is in use.
+    };
+
+    /**
+     * @brief Concurrency bookkeeping of one sound ID.
+     */
+    struct SoundIDState {
+        std::size_t active = 0;  ///< Voices currently playing this ID.
+        std::size_t limit = std::numeric_limits<std::size_t>::max(); ///< Maximum concurrent voices.
+    };
+
+    VoiceStealPolicy stealPolicy;                      ///< Policy when no voice is available.
+    std::unique_ptr<sf::SoundBuffer> silence;          ///< Empty buffer idle voices are bound to.
+    std::vector<Voice> voices;                         ///< All voices.
+    std::vector<std::uint32_t> freeVoices;             ///< Indices of idle voices.
+    std::unordered_map<std::uint64_t, std::uint32_t> soundIDs; ///< Sound ID hash to index in idStates.
+    std::vector<SoundIDState> idStates;                ///< Per-ID concurrency state.
+    std::uint64_t playCounter = 0;                     ///< Orders voices by start time.
+    std::uint64_t stolenCount = 0;                     ///< Voices stopped to make room.
+    std::uint64_t droppedCount = 0;                    ///< Play requests that got no voice.
+
+    std::uint32_t internID(StringId ID);
+    void release(std::uint32_t voice);
+    /**
+     * @brief Picks a busy voice to stop, optionally only among voices playing one ID.
+     * @return The voice index, or INVALID if the policy forbids stealing.
+     */
+    std::uint32_t chooseVictim(const SoundParams &params, const std::uint32_t *soundID) const;
+
+   public:
+    /**
+     * @brief Creates every voice up front.
+     * @param config Voice count and stealing policy.
+     */
+    explicit SoundPool(const SoundPoolConfig &config = {});
+    /**
+     * @brief Stops every voice.
+     */
+    ~SoundPool();
+    SoundPool(SoundPool &&) noexcept = default;
+    SoundPool(const SoundPool &) = delete;
+    SoundPool &operator=(const SoundPool &) = delete;
+
+    /**
+     * @brief Limits how many voices may play the same sound ID at once.
+     * @param ID Sound ID, as passed to play().
+     * @param maxConcurrent Maximum simultaneous voices; further plays steal among them.
+     */
+    void setVoiceLimit(StringId ID, std::size_t maxConcurrent);
+
+    /**
+     * @brief Starts a sound on a free or stolen voice.
+     * @param ID Sound ID used for concurrency caps.
+     * @param buffer Samples to play; must outlive the playback.
+     * @param params Volume, pitch and priority.
+     * @return Handle to the playback, invalid if the sound was dropped.
+     */
+    VoiceHandle play(StringId ID, const sf::SoundBuffer &buffer,
+                     const SoundParams &params = {});
+
+    /**
+     * @brief Stops a playback early. Stale handles are ignored.
+     */
+    void stop(const VoiceHandle &handle);
+
+    /**
+     * @brief Stops every playback.
+     */
+    void stopAll();
+
+    /**
+     * @brief Stops every playback of one sound ID, e.g. before unloading its buffer.
+     */
+    void stopAll(StringId ID);
+
+    /**
+     * @brief Checks whether a playback is still running.
+     */
+    bool isPlaying(const VoiceHandle &handle) const;
+
+    /**
+     * @brief Returns finished voices to the free list. Call once per frame.
+     */
+    void update();
+
+    /**
+     * @brief Gets the number of voices in use.
+     */
+    std::size_t getActiveCount() const { return voices.size() - freeVoices.size(); }
+    /**
+     * @brief Gets the total number of voices.
+     */
+    std::size_t getVoiceCount() const { return voices.size(); }
+    /**
+     * @brief Gets how many playbacks were cut short to make room.
+     */
+    std::uint64_t getStolenCount() const { return stolenCount; }
+    /**
+     * @brief Gets how many play requests were dropped.
+     */
+    std::uint64_t getDroppedCount() const { return droppedCount; }
+};
@@ -0,0 +1,188 @@
+/**
+ * @file FlowField.hpp
+ * @brief Declares FlowField, shared pathfinding for every enemy heading to the same goals.
+ */
+#pragma once
+#include <SFML/System.hpp>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Map/MapGrid.hpp"
+
+/**
+ * @struct FlowFieldSnapshot
+ * @brief Immutable published state of a flow field: a distance and a direction per cell.
+ */
+struct FlowFieldSnapshot {
+    static constexpr std::uint32_t UNREACHABLE = std::numeric_limits<std::uint32_t>::max();
+    static constexpr std::uint8_t NO_DIRECTION = 8; ///< Direction of goals and unreachable cells.
+
+    sf::Vector2i size;                    ///< Columns and rows of the map.
+    float cellSize = 1.f;                 ///< Edge length of a cell in world units.
+    std::uint64_t version = 0;            ///< Incremented by every publish.
+    std::vector<std::uint32_t> distance;  ///< Cost to the nearest goal, row-major; UNREACHABLE if cut off.
+    std::vector<std::uint8_t> direction;  ///< Index in DIRECTIONS of the next step, row-major.
+
+    /**
+     * @brief Unit vector of each direction index: E, SE, S, SW, W, NW, N, NE.
+     */
+    static const std::array<sf::Vector2f, 9> DIRECTIONS;
+
+    /**
+     * @brief Gets the direction to walk from a cell; zero on goals, unreachable cells and off the map.
+     */
+    sf::Vector2f getDirection(sf::Vector2i cell) const {
+        if (cell.x < 0 || cell.y < 0 || cell.x >= size.x || cell.y >= size.y) return {};
+        return DIRECTIONS[direction[static_cast<std::size_t>(cell.y) * size.x + cell.x]];
+    }
+
+    /**
+     * @brief Gets the direction to walk from a world position.
+     */
+    sf::Vector2f getDirectionAt(sf::Vector2f position) const;
+
+    /**
+     * @brief Gets the cost from a cell to the nearest goal; UNREACHABLE off the map or if cut off.
+     */
+    std::uint32_t getDistance(sf::Vector2i cell) const {
+        if (cell.x < 0 || cell.y < 0 || cell.x >= size.x || cell.y >= size.y) return UNREACHABLE;
+        return distance[static_cast<std::size_t>(cell.y) * size.x + cell.x];
+    }
+};
+
+/**
+ * @class FlowField
+ * @brief Keeps a Dijkstra integration field towards a set of goals up to date as tiles change.
+ *
+ * Every cell stores its cost to the nearest goal and the neighbor to step to,
+ * so any number of enemies find their way with one O(1) lookup each instead
+ * of a search per enemy. Moves go to the 8 neighbors; diagonal moves may not
+ * cut the corner of a blocked tile.
+ *
+ * Tile edits are repaired incrementally. When a tile gets more expensive or
+ * blocked, only the cells whose route ran through it are reset and
+ * re-solved from the edge of that region; when a tile gets cheaper or opens
+ * up, improvements are propagated outwards from it until they stop. Placing a
+ * tower therefore costs in proportion to the area it reroutes, not the map.
+ *
+ * In threaded mode the repair runs on a worker thread. Results are published
+ * as FlowFieldSnapshot objects that readers hold through shared pointers; the
+ * worker alternates between two snapshot buffers, so a publish copies the
+ * field without allocating unless a reader still holds the buffer it wants.
+ */
+class FlowField {
+   private:
+    /**
+     * @brief A queued tile change.
+     */
+    struct Edit {
+        sf::Vector2i cell;   ///< Tile to change.
+        std::uint8_t cost;   ///< New cost.
+    };
+
+    // Solver state, only touched by the worker (or by the caller when not threaded)
+    MapGrid grid;                                   ///< The solver's copy of the tile costs.
+    std::vector<std::uint8_t> isGoal;               ///< 1 for goal cells, row-major.
+    std::vector<std::uint32_t> distance;            ///< Working distances.
+    std::vector<std::uint8_t> direction;            ///< Working directions.
+    std::vector<std::uint32_t> mark;                ///< Repair number that last reset each cell.
+    std::uint32_t repair = 0;                       ///< Current repair number.
+    std::vector<std::uint32_t> region;              ///< Cells reset by the current repair.
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> heap; ///< Dijkstra queue of (distance, cell).
+    std::vector<Edit> appliedEdits;                 ///< Edits taken from the queue by the worker.
+
+    // Publishing
+    std::array<std::shared_ptr<FlowFieldSnapshot>, 2> buffers; ///< Snapshot buffers the worker alternates.
+    std::size_t nextBuffer = 0;                     ///< Buffer the next publish writes.
+    std::uint64_t version = 0;                      ///< Version of the last publish.
+    mutable std::mutex publishedMutex;              ///< Guards published.
+    std::shared_ptr<const FlowFieldSnapshot> published; ///< Latest snapshot.
+
+    // Worker
+    std::mutex editMutex;                           ///< Guards pendingEdits, busy and stopping.
+    std::condition_variable editsQueued;            ///< Signalled when edits arrive or the field stops.
+    std::condition_variable editsDone;              ///< Signalled when the worker runs out of edits.
+    std::vector<Edit> pendingEdits;                 ///< Edits waiting for the worker.
+    bool busy = false;                              ///< Whether the worker is repairing.
+    bool stopping = false;                          ///< Set by the destructor.
+    std::thread worker;                             ///< Repair thread; not started when not threaded.
+
+    void workerLoop();
+
+    /**
+     * @brief Solves the whole field from scratch.
+     */
+    void computeAll();
+
+    /**
+     * @brief Changes a tile's cost and repairs the field around it.
+     */
+    void applyEdit(const Edit &edit);
+
+    /**
+     * @brief Repairs after a tile got more expensive: re-solves the cells routed through it.
+     */
+    void raise(std::uint32_t cell);
+
+    /**
+     * @brief Repairs after a tile got cheaper: spreads the improvement outwards.
+     * @param wasBlocked Whether the tile was blocked, which also reopens diagonals around it.
+     */
+    void lower(std::uint32_t cell, bool wasBlocked);
+
+    /**
+     * @brief Runs Dijkstra from the cells in the heap until no distance improves.
+     */
+    void relax();
+
+    /**
+     * @brief Copies the working field into a snapshot buffer and publishes it.
+     */
+    void publish();
+
+    /**
+     * @brief Gets the cost of stepping from a cell in a direction.
+     * @return 0 if the step leaves the map, enters or starts on a blocked tile, or cuts a blocked corner.
+     */
+    std::uint32_t stepCost(sf::Vector2i from, int step) const;
+
+   public:
+    /**
+     * @brief Constructor. Solves the whole field before returning.
+     * @param grid Map to solve; the field keeps its own copy.
+     * @param goals Cells enemies head for.
+     * @param threaded Whether edits are repaired on a worker thread; otherwise setCost() repairs in place.
+     */
+    FlowField(const MapGrid &grid, const std::vector<sf::Vector2i> &goals, bool threaded = true);
+    FlowField(const FlowField &) = delete;
+    FlowField &operator=(const FlowField &) = delete;
+
+    /**
+     * @brief Destructor. Stops the worker; queued edits are dropped.
+     */
+    ~FlowField();
+
+    /**
+     * @brief Changes a tile; the field is repaired in the background when threaded.
+     * @param cell Tile to change.
+     * @param cost New cost, MapGrid::BLOCKED for a tower.
+     */
+    void setCost(sf::Vector2i cell, std::uint8_t cost);
+
+    /**
+     * @brief Gets the latest published field. Hold it for a tick rather than fetching it per enemy.
+     */
+    std::shared_ptr<const FlowFieldSnapshot> getSnapshot() const;
+
+    /**
+     * @brief Blocks until every edit made so far is published.
+     */
+    void waitForUpdates();
+};
@@ -0,0 +1,100 @@
+/**
+ * @file MapGrid.hpp
+ * @brief Declares MapGrid, the tile grid enemies walk on and towers are placed on.
+ */
+#pragma once
+#include <SFML/System.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * @class MapGrid
+ * @brief Per-tile movement costs of a rectangular map.
+ *
+ * A cost of 1 is open ground, higher costs are slower terrain, and BLOCKED
+ * tiles (towers, walls) cannot be entered. Tiles are addressed by integer
+ * cell coordinates; cellSize converts them to and from world positions.
+ */
+class MapGrid {
+   private:
+    sf::Vector2i size;                 ///< Number of columns and rows.
+    float cellSize;                    ///< Edge length of a tile in world units.
+    std::vector<std::uint8_t> costs;   ///< Row-major tile costs.
+
+   public:
+    static constexpr std::uint8_t BLOCKED = 255; ///< Cost of a tile that cannot be entered.
+
+    /**
+     * @brief Constructor.
+     * @param size Number of columns and rows.
+     * @param cellSize Edge length of a tile in world units.
+     * @param cost Initial cost of every tile.
+     */
+    explicit MapGrid(sf::Vector2i size, float cellSize = 32.f, std::uint8_t cost = 1)
+        : size(size), cellSize(cellSize), costs(static_cast<std::size_t>(size.x) * size.y, cost) {}
+
+    /**
+     * @brief Gets the number of columns and rows.
+     */
+    sf::Vector2i getSize() const { return size; }
+
+    /**
+     * @brief Gets the edge length of a tile in world units.
+     */
+    float getCellSize() const { return cellSize; }
+
+    /**
+     * @brief Checks whether a cell lies on the map.
+     */
+    bool contains(sf::Vector2i cell) const {
+        return cell.x >= 0 && cell.y >= 0 && cell.x < size.x && cell.y < size.y;
+    }
+
+    /**
+     * @brief Gets the row-major index of a cell on the map.
+     */
+    std::size_t index(sf::Vector2i cell) const { return static_cast<std::size_t>(cell.y) * size.x + cell.x; }
+
+    /**
+     * @brief Gets the cell of a row-major index.
+     */
+    sf::Vector2i cellAt(std::size_t index) const {
+        return {static_cast<int>(index % size.x), static_cast<int>(index / size.x)};
+    }
+
+    /**
+     * @brief Gets the cost of a cell; cells off the map are BLOCKED.
+     */
+    std::uint8_t getCost(sf::Vector2i cell) const { return contains(cell) ? costs[index(cell)] : BLOCKED; }
+
+    /**
+     * @brief Sets the cost of a cell on the map; use BLOCKED for towers and walls.
+     */
+    void setCost(sf::Vector2i cell, std::uint8_t cost) {
+        if (contains(cell)) costs[index(cell)] = cost;
+    }
+
+    /**
+     * @brief Checks whether a cell cannot be entered.
+     */
+    bool isBlocked(sf::Vector2i cell) const { return getCost(cell) == BLOCKED; }
+
+    /**
+     * @brief Gets the cell containing a world position; may be off the map.
+     */
+    sf::Vector2i worldToCell(sf::Vector2f position) const;
+
+    /**
+     * @brief Gets the world position of a cell's center.
+     */
+    sf::Vector2f cellToWorld(sf::Vector2i cell) const {
+        return {(cell.x + 0.5f) * cellSize, (cell.y + 0.5f) * cellSize};
+    }
+
+    /**
+     * @brief Gets every tile cost, row-major.
+     */
+    std::span<const std::uint8_t> getCosts() const { return costs; }
+};
@@ -0,0 +1,100 @@
+/**
+ * @file PlacementValidator.hpp
+ * @brief Declares PlacementValidator, which answers whether a tower may be placed on a tile.
+ */
+#pragma once
+#include <SFML/System.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "Map/MapGrid.hpp"
+
+/**
+ * @class PlacementValidator
+ * @brief Answers "would blocking this tile seal off the path?" in O(1) per query.
+ *
+ * Enemies move between open tiles in 8 directions without cutting blocked
+ * corners, so a diagonal step is only allowed when both tiles beside it are
+ * open and connectivity is the same as moving in 4 directions.
+ *
+ * The validator runs one iterative Tarjan pass over the open tiles from a
+ * virtual node joined to every goal, and caches a flag per tile: whether
+ * the tile is an articulation point cutting some spawn off from all goals.
+ * Placement previews then read the flag while the cursor sweeps the map.
+ * Only edits that block or open a tile invalidate the cache, and the next
+ * query rebuilds it in time linear in the map.
+ */
+class PlacementValidator {
+   private:
+    /**
+     * @brief A DFS stack entry: a node and the next of its edges to follow.
+     */
+    struct Frame {
+        std::uint32_t node;   ///< Cell index, or the virtual goal node.
+        std::uint32_t edge;   ///< Next edge to follow.
+    };
+
+    MapGrid grid;                          ///< The validator's copy of the tile costs.
+    std::vector<std::uint8_t> isSpawn;     ///< 1 for spawn cells, row-major.
+    std::vector<std::uint8_t> isGoal;      ///< 1 for goal cells, row-major.
+    std::vector<std::uint32_t> spawns;     ///< Spawn cell indices.
+    std::vector<std::uint32_t> goals;      ///< Goal cell indices.
+
+    // Cached articulation information
+    bool dirty = true;                     ///< Whether the cache must be rebuilt before the next query.
+    std::uint32_t rebuilds = 0;            ///< Number of rebuilds so far.
+    std::vector<std::uint32_t> discovery;  ///< DFS discovery time per node; 0 if unreached.
+    std::vector<std::uint32_t> low;        ///< Lowest discovery time reachable from each node's subtree.
+    std::vector<std::uint32_t> spawnsBelow; ///< Number of spawns in each cell's DFS subtree.
+    std::vector<std::uint8_t> cutsPath;    ///< 1 for cells whose removal cuts a spawn off from every goal.
+    std::vector<Frame> stack;              ///< DFS stack, kept to reuse its memory.
+
+    /**
+     * @brief Gets the node at the end of an edge, or NO_NODE if the edge leads nowhere.
+     */
+    std::uint32_t neighbor(std::uint32_t node, std::uint32_t edge) const;
+
+    /**
+     * @brief Gets the number of edges to try from a node.
+     */
+    std::uint32_t edgeCount(std::uint32_t node) const;
+
+    /**
+     * @brief Recomputes the articulation information.
+     */
+    void rebuild();
+
+   public:
+    /**
+     * @brief Constructor.
+     * @param grid Map to validate placements on; the validator keeps its own copy.
+     * @param spawns Cells enemies enter from.
+     * @param goals Cells enemies head for.
+     */
+    PlacementValidator(const MapGrid &grid, const std::vector<sf::Vector2i> &spawns,
+                       const std::vector<sf::Vector2i> &goals);
+
+    /**
+     * @brief Changes a tile. Only blocking or opening a tile invalidates the cache.
+     * @param cell Tile to change.
+     * @param cost New cost, MapGrid::BLOCKED for a tower.
+     */
+    void setCost(sf::Vector2i cell, std::uint8_t cost);
+
+    /**
+     * @brief Checks whether a tower may go on a tile.
+     * @return False off the map, on blocked tiles, spawns and goals, and where the
+     *         tower would leave a spawn that can reach a goal with no route to any.
+     */
+    bool canPlace(sf::Vector2i cell);
+
+    /**
+     * @brief Checks whether every spawn can currently reach a goal.
+     */
+    bool isPathOpen();
+
+    /**
+     * @brief Gets the number of times the cache was rebuilt.
+     */
+    std::uint32_t getRebuildCount() const { return rebuilds; }
+};
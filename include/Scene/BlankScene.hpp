@@ -13,11 +13,11 @@
 class BlankScene : public Scene {
     public:
     /**
-     * @brief Constructs a BlankScene with the given window and name.
-     * @param window Reference to the SFML render window.
+     * @brief Constructs a BlankScene with the given render target and name.
+     * @param target Reference to the render target.
      * @param name Name of the scene.
      */
-    BlankScene(sf::RenderWindow &window, const std::string &name) : Scene{window, name} {}
+    BlankScene(sf::RenderTarget &target, const std::string &name) : Scene{target, name} {}
     /**
      * @brief Handles an event (no-op for blank scene).
      */
@@ -4,9 +4,16 @@
  */
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <cstddef>
 #include <string>
 #include <memory>
+#include <future>
 #include <optional>
+#include <vector>
+
+#include "Core/EntityStore.hpp"
+#include "Core/RenderSnapshot.hpp"
+#include "Scene/SceneContext.hpp"
 /**
  * @class Scene
  * @brief Abstract base class for all game scenes.
@@ -15,20 +22,92 @@
  */
 class Scene : public sf::Drawable {
    protected:
-    sf::RenderWindow &window; ///< Reference to the main window.
+    sf::RenderTarget &target; ///< Target the scene renders into (the main window, or an off-screen texture when headless).
     std::string name; ///< Name of the scene.
+    float interpolation; ///< Fraction of a tick elapsed since the last update, set before each draw.
+    EntityStore entities; ///< Bulk entities (enemies, projectiles) updated by systems rather than per object.
+    std::string musicTrack; ///< Music crossfaded in when the scene becomes current; empty keeps the music playing.
+    SceneContext context; ///< Engine services, set by SceneManager once the scene is built.
+    bool opaque = true; ///< Covers the whole target, so scenes below it on the stack are not drawn.
+    bool pausesBelow = true; ///< Stops scenes below it on the stack from updating while it is on top of them.
+    std::vector<std::string> ownedTextures; ///< IDs of textures loaded through loadTextureAsync().
+    std::vector<std::string> ownedSounds; ///< IDs of sound buffers loaded through loadSoundAsync().
+
+    /**
+     * @brief Queues a background texture load owned by the scene, see ResourceManager::loadTextureAsync().
+     *
+     * Owned assets count towards getMemoryUsage() and are unloaded by onUnload(),
+     * or cancelled if still loading. An ID that is already loaded or loading
+     * elsewhere is refused and not owned.
+     * @return Future set to whether loading succeeded; false at once without context.resources.
+     */
+    std::future<bool> loadTextureAsync(const std::string &path, const std::string &ID);
+    /**
+     * @brief Queues a background sound load owned by the scene, see loadTextureAsync().
+     */
+    std::future<bool> loadSoundAsync(const std::string &path, const std::string &ID);
    public:
     /**
-     * @brief Constructs a Scene with the given window and name.
-     * @param window Reference to the SFML render window.
+     * @brief Constructs a Scene with the given render target and name.
+     * @param target Reference to the render target, usually the main window.
      * @param name Name of the scene.
      */
-    Scene(sf::RenderWindow &window, const std::string &name) : window{window}, name{name} {};
+    Scene(sf::RenderTarget &target, const std::string &name) : target{target}, name{name}, interpolation{0.f} {};
     /**
      * @brief Gets the name of the scene.
      * @return Reference to the scene name string.
      */
     const std::string& getName() const {return name;}
+    /**
+     * @brief Gets the path of the scene's music track.
+     * @return Reference to the path, empty if the scene has no music of its own.
+     */
+    const std::string& getMusicTrack() const {return musicTrack;}
+    /**
+     * @brief Checks whether the scene hides every scene below it on the stack. Overlays clear this.
+     */
+    bool isOpaque() const {return opaque;}
+    /**
+     * @brief Checks whether scenes below this one on the stack stop updating.
+     */
+    bool isPausingBelow() const {return pausesBelow;}
+    /**
+     * @brief Sets the engine services the scene may use.
+     * @param context Services owned by the game loop.
+     */
+    void setContext(const SceneContext &context) { this->context = context; }
+    /**
+     * @brief Called on the game loop thread once the scene is built, before it is first entered.
+     *
+     * Scenes may be constructed on a worker thread by SceneManager::preload(),
+     * so constructors should only do CPU work; asset loads go here, through
+     * ResourceManager's asynchronous loads on context.resources.
+     */
+    virtual void onLoad() {}
+    /**
+     * @brief Called when the scene becomes the current scene.
+     */
+    virtual void onEnter() {}
+    /**
+     * @brief Called when another scene replaces this one. The scene may be evicted afterwards.
+     */
+    virtual void onExit() {}
+    /**
+     * @brief Called on the game loop thread right before SceneManager destroys the scene.
+     *
+     * The default unloads the scene's owned assets and cancels those still
+     * loading; overrides releasing
+     * further assets should call it too.
+     */
+    virtual void onUnload();
+    /**
+     * @brief Estimates the memory the scene holds, for SceneManager's eviction budget.
+     *
+     * The default counts the entity store and the owned textures and sounds,
+     * loads in flight by their encoded size;
+     * scenes holding maps or other large state should add it.
+     */
+    virtual std::size_t getMemoryUsage() const;
     /**
      * @brief Handles an input event.
      * @param event Optional SFML event to handle.
@@ -38,17 +117,37 @@ class Scene : public sf::Drawable {
      * @brief Handles real-time input.
      */
     virtual void handleInput() = 0;
+    /**
+     * @brief Sets the interpolation alpha used by the next draw call.
+     * @param alpha Value in [0, 1) describing progress towards the next tick.
+     */
+    void setInterpolation(float alpha) { interpolation = alpha; }
     /**
      * @brief Draws the scene to the given render target.
+     *
+     * Implementations should blend between the previous and current simulation
+     * state using the interpolation member.
      * @param target The render target.
      * @param state The render states.
      */
     virtual void draw(sf::RenderTarget& target,
                       sf::RenderStates state) const = 0;
     /**
-     * @brief Updates the scene.
+     * @brief Describes what draw() would draw, for the render thread when simulation runs on its own thread.
+     *
+     * Called on the simulation thread after each tick. The default leaves the snapshot empty.
+     * @param snapshot Cleared snapshot to fill.
+     */
+    virtual void snapshot(RenderSnapshot &snapshot) const {}
+    /**
+     * @brief Updates the scene by one tick of GameConstants::TICK_INTERVAL.
      */
     virtual void update() = 0;
+    /**
+     * @brief Advances fine-grained simulation (e.g. fast projectiles) by one
+     * GameConstants::SUBTICK_INTERVAL. Called SUBTICKS_PER_TICK times before each update().
+     */
+    virtual void subtick() {}
     /**
      * @brief Virtual destructor for safe polymorphic destruction.
      */
@@ -0,0 +1,24 @@
+/**
+ * @file SceneContext.hpp
+ * @brief Declares SceneContext, the engine services a scene can use.
+ */
+#pragma once
+
+class FrameArena;
+class JobSystem;
+class ResourceManager;
+
+/**
+ * @struct SceneContext
+ * @brief Engine services handed to every scene by SceneManager.
+ *
+ * The services are owned by whoever runs the loop (Application or
+ * HeadlessRunner), which declares its SceneManager after them so they
+ * outlive the scenes, destructors included. Pointers are null when the
+ * owner does not provide that service.
+ */
+struct SceneContext {
+    FrameArena *frameArena = nullptr; ///< Scratch memory emptied after every frame.
+    JobSystem *jobSystem = nullptr;   ///< Worker threads for fanning an update out across cores.
+    ResourceManager *resources = nullptr; ///< Assets; scenes queue their background loads in Scene::onLoad().
+};
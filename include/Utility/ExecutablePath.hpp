@@ -0,0 +1,15 @@
+/**
+ * @file ExecutablePath.hpp
+ * @brief Declares getExecutableDirectory, used to find files shipped next to the game.
+ */
+#pragma once
+#include <filesystem>
+
+/**
+ * @brief Gets the directory holding the running executable.
+ *
+ * Asset paths are resolved against it rather than the working directory, so
+ * the game finds its pack and loose assets however it is launched.
+ * @return The directory, or the working directory if the platform query fails.
+ */
+std::filesystem::path getExecutableDirectory();
@@ -0,0 +1,102 @@
+/**
+ * @file FrameArena.hpp
+ * @brief Declares FrameArena, a linear allocator for scratch data that lives for one frame.
+ */
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @class FrameArena
+ * @brief Bump allocator over one block, emptied all at once when the frame ends.
+ *
+ * Allocating is a pointer bump and freeing is a no-op; Application::run
+ * calls reset() after every frame, so nothing taken from the arena may be
+ * used in the next one. Objects are never destroyed, so only trivially
+ * destructible types may be created directly. Containers go through the
+ * std::pmr interface, e.g. std::pmr::vector<Entity> hits(&arena).
+ *
+ * When a frame needs more than the block, the rest is served from heap
+ * overflow blocks freed by reset(). That frame is slower but still correct,
+ * and the overflow and high-water figures show how big the block should be.
+ */
+class FrameArena : public std::pmr::memory_resource {
+   private:
+    std::unique_ptr<std::byte[]> block;   ///< The arena memory.
+    std::size_t capacity;                 ///< Size of block.
+    std::size_t used = 0;                 ///< Bytes handed out from block this frame, with padding.
+    std::size_t highWater = 0;            ///< Most bytes used in a frame, overflow included.
+    std::size_t overflowBytes = 0;        ///< Bytes served from the heap this frame.
+    std::size_t overflowFrames = 0;       ///< Frames that did not fit in block.
+    std::vector<std::unique_ptr<std::byte[]>> overflow; ///< Heap blocks of this frame.
+
+   protected:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void *, std::size_t, std::size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+   public:
+    /**
+     * @brief Constructor. Allocates the block.
+     * @param capacity Size of the block in bytes.
+     */
+    explicit FrameArena(std::size_t capacity);
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+    /**
+     * @brief Creates an object that lives until the next reset().
+     */
+    template <typename T, typename... Args>
+    T *create(Args &&...args) {
+        static_assert(std::is_trivially_destructible_v<T>, "FrameArena never runs destructors");
+        return ::new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Allocates a value-initialized array that lives until the next reset().
+     */
+    template <typename T>
+    std::span<T> createArray(std::size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "FrameArena never runs destructors");
+        T *array = static_cast<T *>(allocate(sizeof(T) * count, alignof(T)));
+        for (std::size_t index = 0; index < count; index++) ::new (static_cast<void *>(array + index)) T();
+        return {array, count};
+    }
+
+    /**
+     * @brief Frees everything allocated since the last reset.
+     */
+    void reset();
+
+    /**
+     * @brief Gets the bytes allocated this frame, overflow and padding included.
+     */
+    std::size_t getUsed() const { return used + overflowBytes; }
+
+    /**
+     * @brief Gets the size of the block.
+     */
+    std::size_t getCapacity() const { return capacity; }
+
+    /**
+     * @brief Gets the fraction of the block used this frame; above 1 when overflowing.
+     */
+    float getOccupancy() const { return capacity == 0 ? 0.f : static_cast<float>(getUsed()) / capacity; }
+
+    /**
+     * @brief Gets the most bytes any frame allocated so far.
+     */
+    std::size_t getHighWater() const { return highWater; }
+
+    /**
+     * @brief Gets the number of frames that overflowed the block.
+     */
+    std::size_t getOverflowFrames() const { return overflowFrames; }
+};
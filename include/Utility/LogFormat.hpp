@@ -0,0 +1,236 @@
+/**
+ * @file LogFormat.hpp
+ * @brief Allocation-free "{}" formatting used by Logger::logf.
+ *
+ * Format strings are validated at compile time against the argument count.
+ * Arguments are written through LogFormatter specializations into a fixed
+ * LogBuffer, so formatting a message never touches the heap. Add a
+ * LogFormatter<T> specialization to make a new type loggable.
+ */
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @class LogBuffer
+ * @brief Fixed-capacity character buffer that silently truncates on overflow.
+ */
+class LogBuffer {
+   private:
+    char *data;
+    std::size_t capacity;
+    std::size_t length = 0;
+    bool truncated = false;
+
+   public:
+    /**
+     * @brief Wraps caller-owned storage.
+     */
+    LogBuffer(char *storage, std::size_t capacity) : data{storage}, capacity{capacity} {}
+
+    void append(std::string_view text) {
+        std::size_t count = text.size();
+        if (count > capacity - length) {
+            count = capacity - length;
+            truncated = true;
+        }
+        std::memcpy(data + length, text.data(), count);
+        length += count;
+    }
+    void append(char character) {
+        if (length == capacity) {
+            truncated = true;
+            return;
+        }
+        data[length++] = character;
+    }
+    void clear() {
+        length = 0;
+        truncated = false;
+    }
+    std::string_view view() const { return {data, length}; }
+    bool isTruncated() const { return truncated; }
+};
+
+/**
+ * @brief Customization point: specialize with a static format(LogBuffer&, const T&).
+ */
+template <typename T>
+struct LogFormatter;
+
+/**
+ * @brief Satisfied by types Logger::logf knows how to print.
+ */
+template <typename T>
+concept LogFormattable = requires(LogBuffer &buffer, const T &value) {
+    LogFormatter<T>::format(buffer, value);
+};
+
+template <std::integral T>
+struct LogFormatter<T> {
+    static void format(LogBuffer &buffer, T value) {
+        char text[24];
+        auto result = std::to_chars(text, text + sizeof(text), value);
+        buffer.append(std::string_view(text, result.ptr - text));
+    }
+};
+
+template <std::floating_point T>
+struct LogFormatter<T> {
+    static void format(LogBuffer &buffer, T value) {
+        char text[32];
+        auto result = std::to_chars(text, text + sizeof(text), value);
+        buffer.append(std::string_view(text, result.ptr - text));
+    }
+};
+
+template <>
+struct LogFormatter<bool> {
+    static void format(LogBuffer &buffer, bool value) {
+        buffer.append(value ? "true" : "false");
+    }
+};
+
+template <>
+struct LogFormatter<char> {
+    static void format(LogBuffer &buffer, char value) { buffer.append(value); }
+};
+
+template <>
+struct LogFormatter<std::string_view> {
+    static void format(LogBuffer &buffer, std::string_view value) { buffer.append(value); }
+};
+
+template <>
+struct LogFormatter<std::string> {
+    static void format(LogBuffer &buffer, const std::string &value) { buffer.append(value); }
+};
+
+template <>
+struct LogFormatter<const char *> {
+    static void format(LogBuffer &buffer, const char *value) {
+        buffer.append(value != nullptr ? std::string_view(value) : std::string_view("(null)"));
+    }
+};
+
+template <>
+struct LogFormatter<char *> : LogFormatter<const char *> {};
+
+/**
+ * @brief Other pointers print as hexadecimal addresses.
+ */
+template <typename T>
+struct LogFormatter<T *> {
+    static void format(LogBuffer &buffer, const T *value) {
+        char text[2 + sizeof(std::uintptr_t) * 2];
+        text[0] = '0';
+        text[1] = 'x';
+        auto result = std::to_chars(text + 2, text + sizeof(text),
+                                    reinterpret_cast<std::uintptr_t>(value), 16);
+        buffer.append(std::string_view(text, result.ptr - text));
+    }
+};
+
+template <typename T>
+struct LogFormatter<sf::Vector2<T>> {
+    static void format(LogBuffer &buffer, const sf::Vector2<T> &value) {
+        buffer.append('(');
+        LogFormatter<T>::format(buffer, value.x);
+        buffer.append(", ");
+        LogFormatter<T>::format(buffer, value.y);
+        buffer.append(')');
+    }
+};
+
+namespace LogFormatDetail {
+/**
+ * @brief Counts "{}" placeholders, treating "{{" and "}}" as escapes.
+ * @return The count, or -1 if the braces are malformed.
+ */
+constexpr int countPlaceholders(std::string_view format) {
+    int count = 0;
+    for (std::size_t index = 0; index < format.size(); index++) {
+        char character = format[index];
+        if (character != '{' && character != '}') continue;
+        if (index + 1 >= format.size()) return -1;
+        char next = format[index + 1];
+        if (character == '{' && next == '}')
+            count++;
+        else if (character != next)
+            return -1;
+        index++;
+    }
+    return count;
+}
+
+/**
+ * @brief Deliberately not constexpr: reaching it during constant evaluation is a compile error.
+ */
+void formatStringDoesNotMatchArguments();
+
+/**
+ * @brief Appends literal text up to the next placeholder and moves past it.
+ */
+inline void appendLiteral(LogBuffer &buffer, std::string_view format, std::size_t &position) {
+    while (position < format.size()) {
+        char character = format[position];
+        if (character == '{' || character == '}') {
+            bool placeholder = character == '{' && format[position + 1] == '}';
+            if (!placeholder) buffer.append(character);
+            position += 2;
+            if (placeholder) return;
+            continue;
+        }
+        std::size_t next = format.find_first_of("{}", position);
+        if (next == std::string_view::npos) next = format.size();
+        buffer.append(format.substr(position, next - position));
+        position = next;
+    }
+}
+}  // namespace LogFormatDetail
+
+/**
+ * @struct LogFormatString
+ * @brief Format string checked at compile time against the argument types.
+ *
+ * Constructed implicitly from a string literal. A placeholder count that does
+ * not match the number of arguments, or an unescaped brace, fails to compile.
+ */
+template <typename... Args>
+struct LogFormatString {
+    std::string_view text;
+
+    template <typename String>
+        requires std::convertible_to<const String &, std::string_view>
+    consteval LogFormatString(const String &format) : text{format} {
+        if (LogFormatDetail::countPlaceholders(text) != static_cast<int>(sizeof...(Args)))
+            LogFormatDetail::formatStringDoesNotMatchArguments();
+    }
+};
+
+/**
+ * @brief Writes a formatted message into a buffer.
+ * @param buffer Destination buffer; output is truncated if it does not fit.
+ * @param format Compile-time checked format string.
+ * @param args Values substituted for each "{}".
+ */
+template <typename... Args>
+    requires(LogFormattable<std::decay_t<Args>> && ...)
+void formatTo(LogBuffer &buffer, LogFormatString<std::type_identity_t<Args>...> format,
+              const Args &...args) {
+    std::size_t position = 0;
+    auto formatArgument = [&](const auto &argument) {
+        LogFormatDetail::appendLiteral(buffer, format.text, position);
+        using Decayed = std::decay_t<decltype(argument)>;
+        LogFormatter<Decayed>::format(buffer, argument);
+    };
+    (formatArgument(args), ...);
+    LogFormatDetail::appendLiteral(buffer, format.text, position);
+}
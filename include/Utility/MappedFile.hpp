@@ -0,0 +1,59 @@
+/**
+ * @file MappedFile.hpp
+ * @brief Declares MappedFile, a read-only memory mapping of a whole file.
+ */
+#pragma once
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+/**
+ * @class MappedFile
+ * @brief Maps a file into memory read-only; pages are read from disk on first access.
+ *
+ * Uses mmap on POSIX systems and file mapping objects on Windows. The view
+ * stays valid until the file is closed or the object is destroyed.
+ */
+class MappedFile {
+   private:
+    const std::byte *mapped = nullptr;  ///< Start of the view, nullptr when closed or empty.
+    std::size_t length = 0;             ///< Size of the view in bytes.
+    bool opened = false;                ///< Whether open() succeeded; empty files have no view.
+#ifdef _WIN32
+    void *fileHandle = nullptr;     ///< HANDLE of the open file.
+    void *mappingHandle = nullptr;  ///< HANDLE of the file mapping object.
+#endif
+
+   public:
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    /**
+     * @brief Destructor. Unmaps the file.
+     */
+    ~MappedFile() { close(); }
+
+    /**
+     * @brief Maps a file, closing any file mapped before.
+     * @return False if the file cannot be opened or mapped.
+     */
+    bool open(const std::filesystem::path &path);
+
+    /**
+     * @brief Unmaps the file; views obtained from getData() become invalid.
+     */
+    void close();
+
+    /**
+     * @brief Checks whether a file is mapped.
+     */
+    bool isOpen() const { return opened; }
+
+    /**
+     * @brief Gets the mapped bytes.
+     */
+    std::span<const std::byte> getData() const { return {mapped, length}; }
+};
@@ -0,0 +1,112 @@
+/**
+ * @file MpscQueue.hpp
+ * @brief Declares MpscQueue, a bounded lock-free multi-producer single-consumer ring buffer.
+ */
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**
+ * @class MpscQueue
+ * @brief Bounded ring buffer that any number of threads may push into while one thread pops.
+ *
+ * Each cell carries a sequence number telling producers and the consumer whose
+ * turn it is, so neither side ever takes a lock (Vyukov's bounded queue).
+ * Pushing into a full queue fails instead of blocking; the caller decides what
+ * to do with the element.
+ *
+ * @tparam T Element type. Must be default constructible and move assignable.
+ */
+template <typename T>
+class MpscQueue {
+   private:
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    /**
+     * @brief One slot of the ring together with its turn counter.
+     */
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T data;
+    };
+
+    std::unique_ptr<Cell[]> cells;  ///< Ring storage.
+    std::size_t mask;               ///< Capacity - 1, capacity being a power of two.
+    alignas(CACHE_LINE) std::atomic<std::size_t> enqueuePosition;  ///< Next slot producers claim.
+    alignas(CACHE_LINE) std::size_t dequeuePosition;  ///< Next slot the consumer reads.
+
+    static std::size_t roundUpToPowerOfTwo(std::size_t value) {
+        std::size_t result = 2;
+        while (result < value) result <<= 1;
+        return result;
+    }
+
+   public:
+    /**
+     * @brief Constructs a queue holding at least the given number of elements.
+     * @param minimumCapacity Requested capacity, rounded up to a power of two.
+     */
+    explicit MpscQueue(std::size_t minimumCapacity)
+        : cells{std::make_unique<Cell[]>(roundUpToPowerOfTwo(minimumCapacity))},
+          mask{roundUpToPowerOfTwo(minimumCapacity) - 1},
+          enqueuePosition{0},
+          dequeuePosition{0} {
+        for (std::size_t index = 0; index <= mask; index++)
+            cells[index].sequence.store(index, std::memory_order_relaxed);
+    }
+
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue &operator=(const MpscQueue &) = delete;
+
+    /**
+     * @brief Tries to append an element. Safe to call from any thread.
+     * @param value Element to move into the queue.
+     * @return False if the queue is full; value is left untouched in that case.
+     */
+    bool tryPush(T &&value) {
+        std::size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell &cell = cells[position & mask];
+            std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::ptrdiff_t>(sequence) -
+                              static_cast<std::ptrdiff_t>(position);
+            if (difference == 0) {
+                if (enqueuePosition.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed)) {
+                    cell.data = std::move(value);
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Tries to remove the oldest element. Only the consumer thread may call this.
+     * @param value Receives the element.
+     * @return False if the queue is empty.
+     */
+    bool tryPop(T &value) {
+        Cell &cell = cells[dequeuePosition & mask];
+        std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (static_cast<std::ptrdiff_t>(sequence) -
+                static_cast<std::ptrdiff_t>(dequeuePosition + 1) < 0)
+            return false;
+        value = std::move(cell.data);
+        cell.sequence.store(dequeuePosition + mask + 1, std::memory_order_release);
+        dequeuePosition++;
+        return true;
+    }
+
+    /**
+     * @brief Gets the number of elements the queue can hold.
+     */
+    std::size_t capacity() const { return mask + 1; }
+};
@@ -0,0 +1,178 @@
+/**
+ * @file ObjectPool.hpp
+ * @brief Declares PoolHandle and ObjectPool, fixed-capacity storage for short-lived gameplay objects.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**
+ * @struct PoolHandle
+ * @brief Stable reference to a pooled object: a slot index plus the slot's generation.
+ *
+ * Destroying the object moves the slot's generation on, so the handle then
+ * resolves to nullptr instead of to whatever reuses the slot.
+ *
+ * @tparam T Pooled type, so handles of different pools cannot be mixed up.
+ */
+template <typename T>
+struct PoolHandle {
+    static constexpr std::uint32_t INVALID = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t index = INVALID;  ///< Slot in the pool.
+    std::uint32_t generation = 0;   ///< Generation of the slot when the handle was issued.
+    /**
+     * @brief Checks whether the handle was ever issued; it may still be stale.
+     */
+    bool isValid() const { return index != INVALID; }
+    bool operator==(const PoolHandle &) const = default;
+};
+
+/**
+ * @class ObjectPool
+ * @brief Constructs objects of one type in slots allocated once, up front.
+ *
+ * Projectiles, hit effects and damage numbers live for a few frames each;
+ * creating them here is a free-list pop and a placement new, and destroying
+ * them a destructor call and a push, so firing rates never reach the global
+ * heap. Objects never move, and the pool reports how full it is and the
+ * most objects it ever held, to size the capacity from play sessions.
+ *
+ * @tparam T Pooled type.
+ */
+template <typename T>
+class ObjectPool {
+   public:
+    using HandleType = PoolHandle<T>;
+
+   private:
+    /**
+     * @brief Storage for one object and the bookkeeping of its slot.
+     */
+    struct Slot {
+        alignas(T) std::byte storage[sizeof(T)]; ///< The object, when alive.
+        std::uint32_t generation = 0;  ///< Bumped whenever the slot is freed.
+        std::uint32_t nextFree = 0;    ///< Next free slot while this one is free.
+        bool alive = false;            ///< Whether storage holds an object.
+    };
+
+    std::unique_ptr<Slot[]> slots;     ///< Slot storage.
+    std::uint32_t capacity;            ///< Number of slots.
+    std::uint32_t firstFree;           ///< Head of the free list; capacity when the pool is full.
+    std::uint32_t count = 0;           ///< Live objects.
+    std::uint32_t highWater = 0;       ///< Most live objects at once.
+    std::size_t failedCreates = 0;     ///< create() calls refused because the pool was full.
+
+    T *object(std::uint32_t index) const { return std::launder(reinterpret_cast<T *>(slots[index].storage)); }
+
+   public:
+    /**
+     * @brief Constructor. Allocates every slot.
+     * @param capacity Most objects alive at once.
+     */
+    explicit ObjectPool(std::uint32_t capacity)
+        : slots(std::make_unique<Slot[]>(capacity)), capacity(capacity), firstFree(0) {
+        for (std::uint32_t index = 0; index < capacity; index++) slots[index].nextFree = index + 1;
+    }
+    ObjectPool(const ObjectPool &) = delete;
+    ObjectPool &operator=(const ObjectPool &) = delete;
+
+    /**
+     * @brief Destructor. Destroys the objects still alive.
+     */
+    ~ObjectPool() { clear(); }
+
+    /**
+     * @brief Constructs an object in a free slot.
+     * @return Handle to the object, or an invalid handle if the pool is full.
+     */
+    template <typename... Args>
+    HandleType create(Args &&...args) {
+        if (firstFree == capacity) {
+            failedCreates++;
+            return {};
+        }
+        const std::uint32_t index = firstFree;
+        Slot &slot = slots[index];
+        ::new (static_cast<void *>(slot.storage)) T(std::forward<Args>(args)...);
+        firstFree = slot.nextFree;
+        slot.alive = true;
+        count++;
+        if (count > highWater) highWater = count;
+        return {index, slot.generation};
+    }
+
+    /**
+     * @brief Destroys an object; every handle to it becomes stale.
+     * @return False if the handle was already stale.
+     */
+    bool destroy(HandleType handle) {
+        if (get(handle) == nullptr) return false;
+        Slot &slot = slots[handle.index];
+        object(handle.index)->~T();
+        slot.alive = false;
+        slot.generation++;
+        slot.nextFree = firstFree;
+        firstFree = handle.index;
+        count--;
+        return true;
+    }
+
+    /**
+     * @brief Destroys every object. The high-water mark is kept.
+     */
+    void clear() {
+        for (std::uint32_t index = 0; index < capacity; index++)
+            if (slots[index].alive) destroy({index, slots[index].generation});
+    }
+
+    /**
+     * @brief Resolves a handle.
+     * @return The object, or nullptr if the handle is invalid or stale.
+     */
+    T *get(HandleType handle) const {
+        if (handle.index >= capacity) return nullptr;
+        const Slot &slot = slots[handle.index];
+        if (!slot.alive || slot.generation != handle.generation) return nullptr;
+        return object(handle.index);
+    }
+
+    /**
+     * @brief Calls a function with the handle and object of every live object, in slot order.
+     *
+     * The function may destroy the object it is given, but not others.
+     */
+    template <typename Function>
+    void forEach(Function &&function) {
+        for (std::uint32_t index = 0; index < capacity; index++)
+            if (slots[index].alive) function(HandleType{index, slots[index].generation}, *object(index));
+    }
+
+    /**
+     * @brief Gets the number of live objects.
+     */
+    std::uint32_t size() const { return count; }
+
+    /**
+     * @brief Gets the most objects that can be alive at once.
+     */
+    std::uint32_t getCapacity() const { return capacity; }
+
+    /**
+     * @brief Gets the fraction of slots in use, in [0, 1].
+     */
+    float getOccupancy() const { return capacity == 0 ? 0.f : static_cast<float>(count) / capacity; }
+
+    /**
+     * @brief Gets the most objects that were alive at once.
+     */
+    std::uint32_t getHighWater() const { return highWater; }
+
+    /**
+     * @brief Gets the number of create() calls refused because the pool was full.
+     */
+    std::size_t getFailedCreates() const { return failedCreates; }
+};
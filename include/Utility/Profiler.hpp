@@ -0,0 +1,122 @@
+/**
+ * @file Profiler.hpp
+ * @brief Declares the frame profiler: RAII zones, per-phase percentiles and Chrome trace export.
+ *
+ * Instrument code with PROFILE_SCOPE("Name") and mark frame boundaries with
+ * PROFILE_FRAME_END(). The macros expand to nothing unless ENABLE_PROFILER is
+ * defined (cmake -DENABLE_PROFILER=ON), so instrumented code costs nothing in
+ * normal builds.
+ */
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct ProfileEvent
+ * @brief One completed zone, as recorded by a thread.
+ */
+struct ProfileEvent {
+    const char *name;     ///< Zone name; must be a string literal or otherwise outlive the profiler.
+    std::int64_t start;   ///< Begin timestamp in nanoseconds.
+    std::int64_t end;     ///< End timestamp in nanoseconds.
+};
+
+/**
+ * @struct PhaseSummary
+ * @brief Rolling per-frame statistics of one zone name.
+ */
+struct PhaseSummary {
+    const char *name;     ///< Zone name.
+    double p50Ms;         ///< Median time per frame, in milliseconds.
+    double p99Ms;         ///< 99th percentile time per frame, in milliseconds.
+    double maxMs;         ///< Worst frame in the window, in milliseconds.
+    std::size_t samples;  ///< Number of frames in the window that ran this zone.
+};
+
+/**
+ * @class Profiler
+ * @brief Collects zone timings from every thread into per-thread ring buffers.
+ *
+ * Recording only touches the calling thread's buffer. Summaries are computed
+ * by the one thread that calls endFrame() (the game loop), from the zones of
+ * every thread. Both may run while other threads record: events a thread
+ * overwrites during the read are detected and skipped, not read torn.
+ */
+class Profiler {
+   public:
+    static constexpr std::size_t EVENTS_PER_THREAD = 1 << 16;  ///< Ring size; oldest events are overwritten.
+    static constexpr std::size_t SUMMARY_WINDOW = 240;         ///< Frames kept for percentiles.
+    static constexpr std::size_t SUMMARY_LOG_INTERVAL = 600;   ///< Frames between summary log lines.
+
+    /**
+     * @brief Gets the current profiler timestamp in nanoseconds.
+     */
+    static std::int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+    /**
+     * @brief Appends a completed zone to the calling thread's ring buffer.
+     */
+    static void record(const char *name, std::int64_t start, std::int64_t end);
+    /**
+     * @brief Names the calling thread in exported traces.
+     */
+    static void setThreadName(const char *name);
+    /**
+     * @brief Folds every thread's zones finished since the previous call into the
+     * rolling per-phase statistics, logging a summary every SUMMARY_LOG_INTERVAL frames.
+     *
+     * Zones with equal names are merged, whichever thread recorded them.
+     */
+    static void endFrame();
+    /**
+     * @brief Computes p50/p99 per zone name over the last SUMMARY_WINDOW frames.
+     */
+    static std::vector<PhaseSummary> getSummary();
+    /**
+     * @brief Writes getSummary() to the log at LogLevel::PERFORMANCE.
+     */
+    static void logSummary();
+    /**
+     * @brief Writes every buffered zone as Chrome trace_event JSON (chrome://tracing, Perfetto).
+     * @param path Output file path.
+     * @return False if the file could not be written.
+     */
+    static bool exportChromeTrace(const std::string &path);
+};
+
+/**
+ * @class ProfileZone
+ * @brief Times the enclosing scope and records it on destruction.
+ */
+class ProfileZone {
+   private:
+    const char *name;
+    std::int64_t start;
+
+   public:
+    explicit ProfileZone(const char *name) : name{name}, start{Profiler::now()} {}
+    ~ProfileZone() { Profiler::record(name, start, Profiler::now()); }
+    ProfileZone(const ProfileZone &) = delete;
+    ProfileZone &operator=(const ProfileZone &) = delete;
+};
+
+#define PROFILER_CONCAT_INNER(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_INNER(a, b)
+
+#ifdef ENABLE_PROFILER
+#define PROFILE_SCOPE(name) ProfileZone PROFILER_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_THREAD_NAME(name) Profiler::setThreadName(name)
+#define PROFILE_FRAME_END() Profiler::endFrame()
+#define PROFILE_EXPORT(path) Profiler::exportChromeTrace(path)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_THREAD_NAME(name) ((void)0)
+#define PROFILE_FRAME_END() ((void)0)
+#define PROFILE_EXPORT(path) ((void)0)
+#endif
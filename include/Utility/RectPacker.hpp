@@ -0,0 +1,65 @@
+/**
+ * @file RectPacker.hpp
+ * @brief Declares RectPacker, a MaxRects bin packer used to build texture atlases.
+ */
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * @class RectPacker
+ * @brief Places rectangles in a fixed-size bin without overlap.
+ *
+ * Keeps the list of maximal free rectangles and puts each new rectangle in
+ * the free one that leaves the shortest leftover side (best short side fit).
+ * Results are best when rectangles are inserted largest first.
+ */
+class RectPacker {
+   private:
+    sf::Vector2i binSize;                 ///< Size of the bin.
+    int padding;                          ///< Empty pixels kept right of and below every rectangle.
+    std::vector<sf::IntRect> freeRects;   ///< Maximal free rectangles; none contains another.
+    std::int64_t usedArea = 0;            ///< Area of the inserted rectangles, without padding.
+
+    /**
+     * @brief Cuts a placed rectangle out of every free rectangle it overlaps.
+     */
+    void splitFreeRects(const sf::IntRect &placed);
+
+    /**
+     * @brief Removes free rectangles contained in another one.
+     */
+    void pruneFreeRects();
+
+   public:
+    /**
+     * @brief Constructor.
+     * @param binSize Size of the bin.
+     * @param padding Empty pixels kept between rectangles, to stop filtering from bleeding.
+     */
+    explicit RectPacker(sf::Vector2i binSize, int padding = 0);
+
+    /**
+     * @brief Places a rectangle.
+     * @param size Size of the rectangle.
+     * @return Where it was placed, or nothing if it does not fit.
+     */
+    std::optional<sf::IntRect> insert(sf::Vector2i size);
+
+    /**
+     * @brief Empties the bin.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the size of the bin.
+     */
+    sf::Vector2i getSize() const { return binSize; }
+
+    /**
+     * @brief Gets the fraction of the bin covered by inserted rectangles.
+     */
+    float getOccupancy() const;
+};
@@ -8,6 +8,7 @@
  */
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <string_view>
 
 /**
  * @enum Mouse
@@ -26,6 +27,8 @@ enum class Key;
  *
  * SignalMap provides static methods to convert SFML mouse and keyboard button enums
  * (sf::Mouse::Button and sf::Keyboard::Key) to the project's own Mouse and Key enums.
+ * The key tables are generated at compile time from a single mapping list, so
+ * every translation is one bounds-checked array load.
  */
 class SignalMap {
     public:
@@ -41,4 +44,22 @@ class SignalMap {
          * @return The corresponding Key enum value.
          */
         static Key mapSfmlKey(sf::Keyboard::Key key);
+        /**
+         * @brief Maps a user-defined Key back to the SFML keyboard key.
+         * @param key The Key to map.
+         * @return The SFML key, or sf::Keyboard::Key::Unknown for Key::Unknown.
+         */
+        static sf::Keyboard::Key mapKeyToSfml(Key key);
+        /**
+         * @brief Gets the stable name of a key, suitable for saving key bindings.
+         * @param key The Key to name.
+         * @return The enumerator name, e.g. "Space", or "Unknown".
+         */
+        static const char* getKeyName(Key key);
+        /**
+         * @brief Finds the key with the given name (inverse of getKeyName).
+         * @param name Name produced by getKeyName.
+         * @return The matching Key, or Key::Unknown if the name is not recognised.
+         */
+        static Key findKey(std::string_view name);
 };
\ No newline at end of file
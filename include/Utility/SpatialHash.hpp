@@ -0,0 +1,156 @@
+/**
+ * @file SpatialHash.hpp
+ * @brief Declares SpatialHash, a uniform-grid index over world-space boxes for range queries.
+ */
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @class SpatialHash
+ * @brief Buckets items by the grid cells their bounds overlap.
+ *
+ * Items are identified by small integer IDs chosen by the caller, e.g. an
+ * Entity index, and may be points (zero-size bounds) or boxes. Moving an item
+ * only touches the grid when it crosses into a different set of cells, so
+ * updating every item once per tick is cheap. Queries only visit the cells
+ * overlapping the query area, and return every matching item exactly once.
+ *
+ * Query cost depends on how many items share a cell. Keep it to a handful:
+ * suggestCellSize() derives a cell size from the world area and item count,
+ * and setCellSize() re-buckets everything when the population changes a lot.
+ */
+class SpatialHash {
+   private:
+    /**
+     * @brief Stored bounds of one item and the cell range it is bucketed in.
+     */
+    struct Item {
+        sf::FloatRect bounds;     ///< World-space bounds.
+        int minX = 0, minY = 0;   ///< First cell covered.
+        int maxX = -1, maxY = -1; ///< Last cell covered; maxX < minX marks an unused ID.
+    };
+
+    float cellSize;                     ///< Edge length of a cell in world units.
+    float inverseCellSize;              ///< 1 / cellSize.
+    std::vector<Item> items;            ///< Items indexed by ID.
+    std::size_t itemCount = 0;          ///< Number of IDs in use.
+    std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> cells; ///< Item IDs per cell.
+    mutable std::vector<std::uint32_t> visitStamp; ///< Last query that reported each ID.
+    mutable std::uint32_t queryStamp = 0;          ///< Current query number.
+    mutable std::vector<std::pair<float, std::uint32_t>> nearestHeap; ///< Scratch space of queryNearest().
+
+    static std::uint64_t cellKey(int x, int y) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+               static_cast<std::uint32_t>(y);
+    }
+    int toCell(float coordinate) const;
+    void link(std::uint32_t id);
+    void unlink(std::uint32_t id);
+    std::uint32_t nextStamp() const;
+    /**
+     * @brief Calls function(id) once for every item in cells [minX, maxX] x [minY, maxY].
+     */
+    template <typename Function>
+    void visitCells(int minX, int minY, int maxX, int maxY, Function &&function) const;
+
+   public:
+    /**
+     * @brief Constructs an empty index.
+     * @param cellSize Edge length of a grid cell in world units.
+     */
+    explicit SpatialHash(float cellSize);
+
+    /**
+     * @brief Computes a cell size giving roughly the wanted number of items per cell.
+     * @param worldArea Area the items are spread over, in world units squared.
+     * @param expectedItems Number of items expected.
+     * @param itemsPerCell Average occupancy to aim for.
+     */
+    static float suggestCellSize(float worldArea, std::size_t expectedItems, float itemsPerCell = 4.f);
+
+    /**
+     * @brief Changes the cell size, re-bucketing every item.
+     */
+    void setCellSize(float newCellSize);
+
+    /**
+     * @brief Gets the edge length of a cell.
+     */
+    float getCellSize() const { return cellSize; }
+
+    /**
+     * @brief Adds an item, or moves it if the ID is already present.
+     * @param id Caller-chosen ID; IDs are used as array indices, so keep them small.
+     * @param bounds World-space bounds; use a zero size for points.
+     */
+    void insert(std::uint32_t id, const sf::FloatRect &bounds);
+
+    /**
+     * @brief Moves an item. Equivalent to insert().
+     */
+    void update(std::uint32_t id, const sf::FloatRect &bounds) { insert(id, bounds); }
+
+    /**
+     * @brief Moves a point item.
+     */
+    void update(std::uint32_t id, sf::Vector2f position) { insert(id, {position, {0.f, 0.f}}); }
+
+    /**
+     * @brief Removes an item. Unknown IDs are ignored.
+     */
+    void remove(std::uint32_t id);
+
+    /**
+     * @brief Removes every item.
+     */
+    void clear();
+
+    /**
+     * @brief Checks whether an ID is present.
+     */
+    bool contains(std::uint32_t id) const { return id < items.size() && items[id].maxX >= items[id].minX; }
+
+    /**
+     * @brief Gets the number of items.
+     */
+    std::size_t size() const { return itemCount; }
+
+    /**
+     * @brief Finds items whose bounds come within a radius of a point.
+     * @param center Query center in world coordinates.
+     * @param radius Query radius.
+     * @param result Receives the IDs; cleared first.
+     */
+    void queryRadius(sf::Vector2f center, float radius, std::vector<std::uint32_t> &result) const;
+
+    /**
+     * @brief Finds items whose bounds overlap a box, e.g. a projectile's hitbox.
+     * @param area Query box in world coordinates.
+     * @param result Receives the IDs; cleared first.
+     */
+    void queryRect(const sf::FloatRect &area, std::vector<std::uint32_t> &result) const;
+
+    /**
+     * @brief Finds the k items closest to a point, nearest first.
+     *
+     * Searches outward ring by ring and stops as soon as no unvisited cell can
+     * hold anything closer than the k-th candidate.
+     *
+     * @param center Query center in world coordinates.
+     * @param count Number of items wanted.
+     * @param maxRadius Items farther than this are ignored.
+     * @param result Receives up to count IDs; cleared first.
+     */
+    void queryNearest(sf::Vector2f center, std::size_t count, float maxRadius,
+                      std::vector<std::uint32_t> &result) const;
+
+    /**
+     * @brief Gets the squared distance from a point to an item's bounds; 0 inside them.
+     */
+    float distanceSquared(std::uint32_t id, sf::Vector2f point) const;
+};
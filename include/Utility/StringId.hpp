@@ -0,0 +1,40 @@
+/**
+ * @file StringId.hpp
+ * @brief Declares StringId, a 64-bit FNV-1a hash of a name, and the "_sid" literal.
+ *
+ * Hot call sites write "coin"_sid, which is hashed at compile time, instead of
+ * building and comparing std::string keys at run time.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @struct StringId
+ * @brief Hashed name used as a lookup key.
+ */
+struct StringId {
+    std::uint64_t value = 0; ///< FNV-1a hash of the name.
+
+    /**
+     * @brief Hashes a name.
+     */
+    static constexpr StringId hash(std::string_view name) {
+        std::uint64_t result = 14695981039346656037ull;
+        for (char character : name) {
+            result ^= static_cast<unsigned char>(character);
+            result *= 1099511628211ull;
+        }
+        return {result};
+    }
+
+    constexpr bool operator==(const StringId &) const = default;
+};
+
+/**
+ * @brief Hashes a string literal at compile time, e.g. "coin"_sid.
+ */
+consteval StringId operator""_sid(const char *name, std::size_t length) {
+    return StringId::hash({name, length});
+}
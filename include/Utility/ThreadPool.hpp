@@ -0,0 +1,76 @@
+/**
+ * @file ThreadPool.hpp
+ * @brief Declares ThreadPool, a fixed set of worker threads running queued tasks.
+ */
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Runs submitted tasks on a fixed number of worker threads, in submission order.
+ *
+ * Destroying the pool discards tasks that have not started and waits for the
+ * running ones; futures of discarded tasks report std::future_errc::broken_promise.
+ */
+class ThreadPool {
+   private:
+    std::vector<std::thread> workers;          ///< Worker threads.
+    std::deque<std::function<void()>> tasks;   ///< Tasks waiting for a worker.
+    std::mutex mutex;                          ///< Guards tasks and stopping.
+    std::condition_variable wakeUp;            ///< Signalled when a task arrives or the pool stops.
+    bool stopping = false;                     ///< Set by the destructor.
+
+    void workerLoop();
+
+   public:
+    /**
+     * @brief Starts the worker threads.
+     * @param threadCount Number of workers; at least one is started.
+     */
+    explicit ThreadPool(std::size_t threadCount = defaultThreadCount());
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+    /**
+     * @brief Discards queued tasks and joins the workers.
+     */
+    ~ThreadPool();
+
+    /**
+     * @brief Queues a task.
+     * @param function Callable taking no arguments.
+     * @return Future receiving the task's result or exception.
+     */
+    template <typename Function>
+    auto submit(Function &&function) -> std::future<std::invoke_result_t<std::decay_t<Function>>> {
+        using Result = std::invoke_result_t<std::decay_t<Function>>;
+        // std::function needs a copyable target, packaged_task is move-only.
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(function));
+        std::future<Result> result = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.emplace_back([task]() { (*task)(); });
+        }
+        wakeUp.notify_one();
+        return result;
+    }
+
+    /**
+     * @brief Gets the number of worker threads.
+     */
+    std::size_t getThreadCount() const { return workers.size(); }
+
+    /**
+     * @brief One worker per hardware thread, leaving one for the game loop.
+     */
+    static std::size_t defaultThreadCount();
+};
@@ -0,0 +1,60 @@
+/**
+ * @file TripleBuffer.hpp
+ * @brief Declares TripleBuffer, a lock-free hand-off of the latest value from one thread to another.
+ */
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class TripleBuffer
+ * @brief Three buffers shared by one writer and one reader, neither of which ever waits.
+ *
+ * The writer fills its back buffer and publishes it by swapping it with the
+ * middle buffer; the reader swaps its front buffer with the middle one when
+ * something new was published. Each side always owns one buffer outright,
+ * so the writer can produce faster or slower than the reader consumes;
+ * values the reader never picked up are simply overwritten. Buffers are
+ * reused, so keeping their allocations (e.g. clear() rather than assigning
+ * a new vector) makes publishing allocation-free.
+ *
+ * @tparam T Buffer type.
+ */
+template <typename T>
+class TripleBuffer {
+   private:
+    static constexpr std::uint8_t INDEX_MASK = 0x3;  ///< Bits of middle holding the buffer index.
+    static constexpr std::uint8_t FRESH = 0x4;       ///< Set in middle when it was published and not read yet.
+
+    std::array<T, 3> buffers;                 ///< The three buffers.
+    alignas(64) std::atomic<std::uint8_t> middle{1}; ///< Index of the buffer being handed over, plus FRESH.
+    alignas(64) std::uint8_t back = 0;        ///< Writer's buffer.
+    alignas(64) std::uint8_t front = 2;       ///< Reader's buffer.
+
+   public:
+    /**
+     * @brief Gets the buffer to fill. Writer thread only.
+     */
+    T &getWriteBuffer() { return buffers[back]; }
+
+    /**
+     * @brief Hands the filled buffer to the reader and takes another one to fill. Writer thread only.
+     */
+    void publish() { back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX_MASK; }
+
+    /**
+     * @brief Picks up the latest published buffer, if there is one the reader has not seen. Reader thread only.
+     * @return True if the read buffer changed.
+     */
+    bool update() {
+        if ((middle.load(std::memory_order_relaxed) & FRESH) == 0) return false;
+        front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * @brief Gets the latest buffer picked up by update(). Reader thread only.
+     */
+    const T &getReadBuffer() const { return buffers[front]; }
+};
@@ -1,12 +1,18 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <sstream>
+
+#include "Utility/LogFormat.hpp"
 /**
  * @file logger.hpp
  * @brief Provides logging utilities with various log levels and formatted output.
  *
  * The Logger class supports colored console output, log levels, and formatted messages for debugging and monitoring application state.
+ * Messages are written synchronously by default; startAsync() moves formatting and I/O to a background thread.
  */
 
 /**
@@ -28,6 +34,43 @@ enum class LogLevel {
     SECURITY
 };
 
+/**
+ * @def LOGGER_MIN_LEVEL
+ * @brief Lowest LogLevel compiled in. Calls below it are removed at compile time.
+ *
+ * Defaults to INFO in release builds (NDEBUG) and TRACE otherwise. Define it on
+ * the compiler command line, e.g. -DLOGGER_MIN_LEVEL=WARNING, to override.
+ */
+#ifndef LOGGER_MIN_LEVEL
+#ifdef NDEBUG
+#define LOGGER_MIN_LEVEL INFO
+#else
+#define LOGGER_MIN_LEVEL TRACE
+#endif
+#endif
+
+/**
+ * @enum LogOverflowPolicy
+ * @brief What an asynchronous log call does when the ring buffer is full.
+ */
+enum class LogOverflowPolicy {
+    Drop,   ///< Discard the record and count it in Logger::getDroppedCount().
+    Block   ///< Wait until the background thread frees a slot.
+};
+
+/**
+ * @struct AsyncLogConfig
+ * @brief Settings for the asynchronous logging backend.
+ */
+struct AsyncLogConfig {
+    std::size_t capacity = 4096;                       ///< Ring buffer size in records (rounded up to a power of two).
+    LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Drop;  ///< Behaviour when the buffer is full.
+    bool writeToConsole = true;                        ///< Write colored lines to stdout.
+    std::string filePath;                              ///< Plain-text log file; empty disables the file sink.
+    std::size_t maxFileSize = 4 * 1024 * 1024;         ///< Rotate before a batch write would exceed this many bytes.
+    int maxFiles = 3;                                  ///< Number of rotated files kept (path.1 .. path.N).
+};
+
 /**
  * @class Logger
  * @brief Static utility class for logging messages with different log levels and formatting.
@@ -40,28 +83,73 @@ private:
     static const char* getColorCode(LogLevel level);
     static const char* getLevelName(LogLevel level);
     static const char* RESET_COLOR;
+    static constexpr std::size_t FORMAT_BUFFER_SIZE = 512; ///< Capacity of the logf buffer per thread.
     
 public:
-    static void log(LogLevel level, const std::string& message);
+    /**
+     * @brief Lowest level that is compiled in, see LOGGER_MIN_LEVEL.
+     */
+    static constexpr LogLevel MIN_LEVEL = LogLevel::LOGGER_MIN_LEVEL;
+    /**
+     * @brief Checks at compile time whether messages of a level are kept.
+     */
+    static constexpr bool isEnabled(LogLevel level) { return level >= MIN_LEVEL; }
+
+    /**
+     * @brief Starts the background logging thread. Later calls reconfigure nothing until stopAsync().
+     * @param config Buffer size, overflow policy and sinks.
+     */
+    static void startAsync(const AsyncLogConfig& config = {});
+    /**
+     * @brief Writes out every queued record and stops the background thread.
+     *
+     * Safe to call while other threads log: it waits for calls already using the
+     * backend to finish, and later calls fall back to synchronous output.
+     */
+    static void stopAsync();
+    /**
+     * @brief Gets the number of records discarded under LogOverflowPolicy::Drop.
+     */
+    static std::uint64_t getDroppedCount();
+
+    static void log(LogLevel level, std::string_view message);
     
-    static void trace(const std::string& message);
-    static void debug(const std::string& message);
-    static void info(const std::string& message);
-    static void success(const std::string& message);
-    static void warning(const std::string& message);
-    static void error(const std::string& message);
-    static void critical(const std::string& message);
-    static void exception(const std::string& message);
-    static void network(const std::string& message);
-    static void performance(const std::string& message);
-    static void memory(const std::string& message);
-    static void security(const std::string& message);
+    static void trace(std::string_view message) {
+        if constexpr (isEnabled(LogLevel::TRACE)) log(LogLevel::TRACE, message);
+    }
+    static void debug(std::string_view message) {
+        if constexpr (isEnabled(LogLevel::DEBUGG)) log(LogLevel::DEBUGG, message);
+    }
+    static void info(std::string_view message);
+    static void success(std::string_view message);
+    static void warning(std::string_view message);
+    static void error(std::string_view message);
+    static void critical(std::string_view message);
+    static void exception(std::string_view message);
+    static void network(std::string_view message);
+    static void performance(std::string_view message);
+    static void memory(std::string_view message);
+    static void security(std::string_view message);
     
+    /**
+     * @brief Logs a message built from a "{}" format string without allocating.
+     *
+     * The format string is checked against the arguments at compile time and
+     * the message is written into a thread-local fixed buffer (longer output is
+     * truncated). Any type with a LogFormatter specialization can be passed.
+     * @param level Log level of the message.
+     * @param format Format string, e.g. "Tower {} fired at {}".
+     * @param args Values substituted for each "{}".
+     */
     template<typename... Args>
-    static void logf(LogLevel level, const std::string& format, Args... args) {
-        std::ostringstream oss;
-        formatMessage(oss, format, args...);
-        log(level, oss.str());
+        requires(LogFormattable<std::decay_t<Args>> && ...)
+    static void logf(LogLevel level, LogFormatString<std::type_identity_t<Args>...> format,
+                     const Args&... args) {
+        if (!isEnabled(level)) return;
+        thread_local char storage[FORMAT_BUFFER_SIZE];
+        LogBuffer buffer(storage, sizeof(storage));
+        formatTo<Args...>(buffer, format, args...);
+        log(level, buffer.view());
     }
     
     static std::string messageAddress(const std::string& message, const void* address) {
@@ -70,26 +158,5 @@ public:
         return oss.str();
     }
 
-private:
-    template<typename T>
-    static void formatMessage(std::ostringstream& oss, const std::string& format, T&& value) {
-        size_t pos = format.find("{}");
-        if (pos != std::string::npos) {
-            oss << format.substr(0, pos) << value << format.substr(pos + 2);
-        } else {
-            oss << format;
-        }
-    }
-    
-    template<typename T, typename... Args>
-    static void formatMessage(std::ostringstream& oss, const std::string& format, T&& value, Args... args) {
-        size_t pos = format.find("{}");
-        if (pos != std::string::npos) {
-            std::string newFormat = format.substr(0, pos) + std::to_string(value) + format.substr(pos + 2);
-            formatMessage(oss, newFormat, args...);
-        } else {
-            oss << format;
-        }
-    }
 };
 
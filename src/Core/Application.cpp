@@ -1,27 +1,48 @@
 #include "Core/Application.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
 #include "Base/Constants.hpp"
 #include "Core/InputManager.hpp"
 #include "Core/MouseState.hpp"
 #include "Core/KeyboardState.hpp"
+#include "Core/RenderQueue.hpp"
 #include "Scene/BlankScene.hpp"
 #include "TestMockClasses/SoundClickTrigger.hpp"
+#include "Utility/ExecutablePath.hpp"
 #include "Utility/logger.hpp"
-Application::Application()
+#include "Utility/Profiler.hpp"
+Application::Application(const ApplicationOptions &options)
     : window(sf::VideoMode(
                  {GameConstants::WINDOW_WIDTH, GameConstants::WINDOW_HEIGHT}),
              "Rampart remains"),
+      inputManager{window},
       testTrigger(resourceManager),
       isRunning{true},
+      frameArena{GameConstants::FRAME_ARENA_BYTES},
       sceneManager{window},
-      inputManager{window} {
+      threaded{options.threaded},
+      eventQueue{GameConstants::INPUT_QUEUE_CAPACITY} {
     if (window.isOpen())
         Logger::success("Window initialization success");
     else
         Logger::error("Window not intitialized");
-    window.setFramerateLimit(60);
-    // * Loading the necessary sounds
-    resourceManager.loadSound("assets/sounds/pickupCoin.wav", "coin");
+    // Only caps rendering; simulation speed is governed by the fixed timestep.
+    window.setFramerateLimit(GameConstants::TARGET_FPS);
+    // * Loading the necessary sounds, from the asset pack when there is one.
+    // Both live next to the executable, wherever the game is started from.
+    const std::filesystem::path assetRoot = getExecutableDirectory();
+    resourceManager.setAssetRoot(assetRoot);
+    if (std::filesystem::exists(assetRoot / GameConstants::ASSET_PACK))
+        resourceManager.mountPack((assetRoot / GameConstants::ASSET_PACK).string());
+    resourceManager.loadSoundAsync("assets/sounds/pickupCoin.wav", "coin");
+    sceneManager.setMusicPlayer(&resourceManager.getMusicPlayer());
+    sceneManager.setContext({&frameArena, &jobSystem, &resourceManager});
     sceneManager.registerScene<BlankScene>("Blank");
     sceneManager.changeScene("Blank");
     testTrigger.subscribeMouse(Mouse::Left, UserEvent::Press, inputManager.getMouseState());
@@ -32,27 +53,161 @@ Application::Application()
 
     testTrigger.subscribeKeyboard(Key::A, UserEvent::Press, inputManager.getKeyboardState());
     // testTrigger.unSubscribeMouse(Mouse::Left, UserEvent::Press, inputManager.getMouseState());
+    if (!options.recordPath.empty() &&
+        inputRecorder.open(options.recordPath,
+                           static_cast<std::uint32_t>(std::lround(1.f / GameConstants::TICK_INTERVAL))))
+        Logger::info("Recording input to " + options.recordPath);
 }
 
 Application::~Application() {
+    PROFILE_EXPORT("profile.json");
+    inputRecorder.close(static_cast<std::uint32_t>(timestep.getTickCount()));
     if (window.isOpen()) window.close();
     Logger::success("Application exit success");
 }
 
 void Application::run() {
+    if (threaded)
+        runThreaded();
+    else
+        runSingleThreaded();
+}
+
+void Application::runSingleThreaded() {
+    PROFILE_THREAD_NAME("Main");
+    sf::Clock frameClock;
+    while (isRunning) {
+        {
+            PROFILE_SCOPE("Frame");
+            {
+                PROFILE_SCOPE("PollEvents");
+                while (auto event = window.pollEvent()) {
+                    if (event->is<sf::Event::Closed>()) {
+                        window.close();
+                        isRunning = false;
+                    }
+                    dispatchEvent(event);
+                }
+            }
+            resourceManager.finishUploads(sf::milliseconds(GameConstants::UPLOAD_BUDGET_MS));
+            sf::Time frameTime = frameClock.restart();
+            resourceManager.getSoundPool().update();
+            resourceManager.getMusicPlayer().update(frameTime);
+            int ticks = timestep.advance(frameTime.asSeconds());
+            for (int tick = 0; tick < ticks; tick++) {
+                {
+                    PROFILE_SCOPE("SceneManager::handleInput");
+                    sceneManager.handleInput();
+                }
+                PROFILE_SCOPE("SceneManager::update");
+                sceneManager.update();
+            }
+            {
+                PROFILE_SCOPE("SceneManager::render");
+                window.clear(sf::Color::Black);
+                sceneManager.render(timestep.getAlpha());
+            }
+            {
+                PROFILE_SCOPE("Display");
+                window.display();
+            }
+            frameArena.reset();
+        }
+        PROFILE_FRAME_END();
+    }
+}
+
+void Application::dispatchEvent(std::optional<sf::Event> &event) {
+    if (event) inputRecorder.record(static_cast<std::uint32_t>(timestep.getTickCount()), *event);
+    {
+        PROFILE_SCOPE("InputManager::handleEvent");
+        inputManager.handleEvent(event);
+    }
+    PROFILE_SCOPE("SceneManager::handleEvent");
+    sceneManager.handleEvent(event);
+}
+
+void Application::runThreaded() {
+    PROFILE_THREAD_NAME("Main");
+    // The render thread takes the window's GL context
+    if (!window.setActive(false)) Logger::warning("Could not release the window context");
+    // Loads and unloads lock out the render thread for just the change to the maps
+    resourceManager.setDrawMutex(&resourceMutex);
+    std::thread simulation(&Application::simulationLoop, this);
+    std::thread render(&Application::renderLoop, this);
     while (isRunning) {
-        window.clear(sf::Color::Black);
+        // SFML only delivers a window's events to the thread that created it
         while (auto event = window.pollEvent()) {
-            if (event->is<sf::Event::Closed>()) {
-                window.close();
-                isRunning = false;
+            if (event->is<sf::Event::Closed>()) isRunning = false;
+            if (!eventQueue.tryPush(std::move(event))) Logger::warning("Input queue full, dropping an event");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    simulation.join();
+    render.join();
+    // The mutex is destroyed before the scenes, which may still unload on their way out
+    resourceManager.setDrawMutex(nullptr);
+    window.close();
+}
+
+void Application::simulationLoop() {
+    PROFILE_THREAD_NAME("Simulation");
+    sf::Clock frameClock;
+    std::optional<sf::Event> event;
+    while (isRunning) {
+        {
+            PROFILE_SCOPE("Simulation");
+            while (eventQueue.tryPop(event)) dispatchEvent(event);
+            if (!resourceManager.getLoadProgress().isDone())
+                resourceManager.finishUploads(sf::milliseconds(GameConstants::UPLOAD_BUDGET_MS));
+            sf::Time frameTime = frameClock.restart();
+            resourceManager.getSoundPool().update();
+            resourceManager.getMusicPlayer().update(frameTime);
+            const int ticks = timestep.advance(frameTime.asSeconds());
+            for (int tick = 0; tick < ticks; tick++) {
+                sceneManager.handleInput();
+                sceneManager.update();
+            }
+            if (ticks > 0) {
+                PROFILE_SCOPE("SceneManager::snapshot");
+                RenderSnapshot &snapshot = snapshots.getWriteBuffer();
+                snapshot.clear();
+                snapshot.tick = timestep.getTickCount();
+                sceneManager.snapshot(snapshot);
+                snapshots.publish();
+                frameArena.reset();
             }
-            inputManager.handleEvent(event);
-            sceneManager.handleEvent(event);
         }
-        sceneManager.handleInput();
-        sceneManager.update();
-        sceneManager.render();
-        window.display();
+        // Sleep until the next tick is due rather than spinning on the clock
+        const float untilNextTick = timestep.getTickInterval() * (1.f - timestep.getAlpha());
+        std::this_thread::sleep_for(std::chrono::duration<float>(untilNextTick));
     }
-}
\ No newline at end of file
+}
+
+void Application::renderLoop() {
+    PROFILE_THREAD_NAME("Render");
+    if (!window.setActive(true)) Logger::error("Could not activate the window context on the render thread");
+    RenderQueue queue(resourceManager);
+    sf::Clock sinceSnapshot;
+    while (isRunning) {
+        {
+            PROFILE_SCOPE("Frame");
+            if (snapshots.update()) sinceSnapshot.restart();
+            // Blend from the previous tick to the published one over one tick interval
+            const float alpha =
+                std::min(1.f, sinceSnapshot.getElapsedTime().asSeconds() / GameConstants::TICK_INTERVAL);
+            const RenderSnapshot &snapshot = snapshots.getReadBuffer();
+            window.clear(snapshot.clearColor);
+            {
+                std::shared_lock<std::shared_mutex> lock(resourceMutex);
+                snapshot.draw(window, queue, resourceManager, alpha);
+            }
+            {
+                PROFILE_SCOPE("Display");
+                window.display();
+            }
+        }
+        PROFILE_FRAME_END();
+    }
+    if (!window.setActive(false)) Logger::warning("Could not release the window context");
+}
@@ -0,0 +1,140 @@
+#include "Core/AssetPack.hpp"
+
+#include <algorithm>
+#include <array>
+#include <ostream>
+
+namespace {
+constexpr std::array<char, 4> MAGIC = {'A', 'P', 'A', 'K'};
+
+template <typename T>
+T readInt(const std::byte *bytes) {
+    T value = 0;
+    for (std::size_t i = 0; i < sizeof(T); i++) value |= static_cast<T>(std::to_integer<T>(bytes[i]) << (8 * i));
+    return value;
+}
+
+template <typename T>
+void writeInt(std::ostream &out, T value) {
+    for (std::size_t i = 0; i < sizeof(T); i++) out.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+}
+
+/**
+ * @brief Decoded table of contents entry.
+ */
+struct Entry {
+    std::uint64_t hash;
+    std::uint64_t offset;
+    std::uint64_t size;
+    std::uint32_t nameOffset;
+    std::uint32_t nameLength;
+};
+
+Entry readEntry(const std::byte *entries, std::size_t index) {
+    const std::byte *bytes = entries + index * AssetPack::ENTRY_SIZE;
+    return {readInt<std::uint64_t>(bytes), readInt<std::uint64_t>(bytes + 8), readInt<std::uint64_t>(bytes + 16),
+            readInt<std::uint32_t>(bytes + 24), readInt<std::uint32_t>(bytes + 28)};
+}
+}  // namespace
+
+bool AssetPack::open(const std::filesystem::path &path) {
+    close();
+    if (!file.open(path)) return false;
+    std::span<const std::byte> data = file.getData();
+    const auto fail = [this]() {
+        close();
+        return false;
+    };
+
+    if (data.size() < HEADER_SIZE || !std::equal(MAGIC.begin(), MAGIC.end(), data.begin(),
+                                                 [](char a, std::byte b) { return static_cast<std::byte>(a) == b; }))
+        return fail();
+    if (readInt<std::uint32_t>(data.data() + 4) != VERSION) return fail();
+    const std::uint64_t count = readInt<std::uint32_t>(data.data() + 8);
+    const std::uint64_t namesSize = readInt<std::uint32_t>(data.data() + 12);
+    const std::uint64_t namesStart = HEADER_SIZE + count * ENTRY_SIZE;
+    if (namesStart + namesSize > data.size()) return fail();
+
+    // Check every entry once so lookups can trust the table
+    for (std::uint64_t index = 0; index < count; index++) {
+        Entry entry = readEntry(data.data() + HEADER_SIZE, index);
+        if (entry.offset > data.size() || entry.size > data.size() - entry.offset) return fail();
+        if (std::uint64_t{entry.nameOffset} + entry.nameLength > namesSize) return fail();
+        if (index > 0 && readEntry(data.data() + HEADER_SIZE, index - 1).hash > entry.hash) return fail();
+    }
+    entries = data.data() + HEADER_SIZE;
+    entryCount = static_cast<std::uint32_t>(count);
+    names = {reinterpret_cast<const char *>(data.data() + namesStart), namesSize};
+    return true;
+}
+
+void AssetPack::close() {
+    file.close();
+    entries = nullptr;
+    entryCount = 0;
+    names = {};
+}
+
+std::span<const std::byte> AssetPack::find(std::string_view name) const {
+    const std::uint64_t hash = StringId::hash(name).value;
+    std::size_t low = 0, high = entryCount;
+    while (low < high) {
+        const std::size_t middle = low + (high - low) / 2;
+        if (readInt<std::uint64_t>(entries + middle * ENTRY_SIZE) < hash)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    if (low == entryCount) return {};
+    Entry entry = readEntry(entries, low);
+    if (entry.hash != hash || names.substr(entry.nameOffset, entry.nameLength) != name) return {};
+    return file.getData().subspan(entry.offset, entry.size);
+}
+
+std::span<const std::byte> AssetPack::findPath(const std::filesystem::path &path) const {
+    if (entryCount == 0) return {};
+    return find(path.lexically_normal().generic_string());
+}
+
+bool AssetPack::contains(std::string_view name) const {
+    // A present but empty file still yields a non-null pointer into the mapping
+    return find(name).data() != nullptr;
+}
+
+bool AssetPack::write(std::ostream &out, std::vector<Source> sources) {
+    std::sort(sources.begin(), sources.end(), [](const Source &a, const Source &b) {
+        return StringId::hash(a.name).value < StringId::hash(b.name).value;
+    });
+    for (std::size_t index = 1; index < sources.size(); index++)
+        if (StringId::hash(sources[index - 1].name) == StringId::hash(sources[index].name)) return false;
+
+    std::string nameTable;
+    for (const Source &source : sources) nameTable += source.name;
+    const auto align = [](std::uint64_t offset) { return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT; };
+
+    out.write(MAGIC.data(), MAGIC.size());
+    writeInt(out, VERSION);
+    writeInt(out, static_cast<std::uint32_t>(sources.size()));
+    writeInt(out, static_cast<std::uint32_t>(nameTable.size()));
+
+    std::uint64_t offset = align(HEADER_SIZE + sources.size() * ENTRY_SIZE + nameTable.size());
+    std::uint32_t nameOffset = 0;
+    for (const Source &source : sources) {
+        writeInt(out, StringId::hash(source.name).value);
+        writeInt(out, offset);
+        writeInt(out, static_cast<std::uint64_t>(source.data.size()));
+        writeInt(out, nameOffset);
+        writeInt(out, static_cast<std::uint32_t>(source.name.size()));
+        offset = align(offset + source.data.size());
+        nameOffset += static_cast<std::uint32_t>(source.name.size());
+    }
+    out.write(nameTable.data(), static_cast<std::streamsize>(nameTable.size()));
+
+    std::uint64_t written = HEADER_SIZE + sources.size() * ENTRY_SIZE + nameTable.size();
+    for (const Source &source : sources) {
+        for (; written % ALIGNMENT != 0; written++) out.put('\0');
+        out.write(reinterpret_cast<const char *>(source.data.data()), static_cast<std::streamsize>(source.data.size()));
+        written += source.data.size();
+    }
+    return static_cast<bool>(out);
+}
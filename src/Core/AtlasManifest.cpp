@@ -0,0 +1,89 @@
+#include "Core/AtlasManifest.hpp"
+
+#include <array>
+#include <istream>
+#include <limits>
+#include <ostream>
+
+namespace {
+constexpr std::array<char, 4> MAGIC = {'A', 'T', 'L', 'S'};
+
+template <typename T>
+void writeInt(std::ostream &out, T value) {
+    auto bits = static_cast<std::make_unsigned_t<T>>(value);
+    for (std::size_t i = 0; i < sizeof(T); i++) out.put(static_cast<char>((bits >> (8 * i)) & 0xFF));
+}
+
+template <typename T>
+bool readInt(std::istream &in, T &value) {
+    std::make_unsigned_t<T> bits = 0;
+    for (std::size_t i = 0; i < sizeof(T); i++) {
+        int byte = in.get();
+        if (byte == std::istream::traits_type::eof()) return false;
+        bits |= static_cast<std::make_unsigned_t<T>>(static_cast<unsigned char>(byte)) << (8 * i);
+    }
+    value = static_cast<T>(bits);
+    return true;
+}
+
+bool writeString(std::ostream &out, const std::string &text) {
+    if (text.size() > std::numeric_limits<std::uint16_t>::max()) return false;
+    writeInt(out, static_cast<std::uint16_t>(text.size()));
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    return true;
+}
+
+bool readString(std::istream &in, std::string &text) {
+    std::uint16_t length;
+    if (!readInt(in, length)) return false;
+    text.resize(length);
+    return static_cast<bool>(in.read(text.data(), length));
+}
+}  // namespace
+
+bool AtlasManifest::write(std::ostream &out) const {
+    out.write(MAGIC.data(), MAGIC.size());
+    writeInt(out, VERSION);
+    writeInt(out, static_cast<std::uint32_t>(pages.size()));
+    for (const std::string &page : pages)
+        if (!writeString(out, page)) return false;
+    writeInt(out, static_cast<std::uint32_t>(sprites.size()));
+    for (const Sprite &sprite : sprites) {
+        if (!writeString(out, sprite.name)) return false;
+        writeInt(out, sprite.page);
+        writeInt(out, static_cast<std::int32_t>(sprite.rect.position.x));
+        writeInt(out, static_cast<std::int32_t>(sprite.rect.position.y));
+        writeInt(out, static_cast<std::int32_t>(sprite.rect.size.x));
+        writeInt(out, static_cast<std::int32_t>(sprite.rect.size.y));
+    }
+    return static_cast<bool>(out);
+}
+
+bool AtlasManifest::read(std::istream &in) {
+    pages.clear();
+    sprites.clear();
+    std::array<char, 4> magic{};
+    std::uint32_t version, pageCount, spriteCount;
+    if (!in.read(magic.data(), magic.size()) || magic != MAGIC) return false;
+    if (!readInt(in, version) || version != VERSION) return false;
+
+    if (!readInt(in, pageCount)) return false;
+    for (std::uint32_t i = 0; i < pageCount; i++) {
+        std::string page;
+        if (!readString(in, page)) return false;
+        pages.push_back(std::move(page));
+    }
+
+    if (!readInt(in, spriteCount)) return false;
+    for (std::uint32_t i = 0; i < spriteCount; i++) {
+        Sprite sprite;
+        std::int32_t x, y, width, height;
+        if (!readString(in, sprite.name) || !readInt(in, sprite.page) || !readInt(in, x) || !readInt(in, y) ||
+            !readInt(in, width) || !readInt(in, height))
+            return false;
+        if (sprite.page >= pages.size()) return false;
+        sprite.rect = sf::IntRect({x, y}, {width, height});
+        sprites.push_back(std::move(sprite));
+    }
+    return true;
+}
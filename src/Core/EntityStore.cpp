@@ -0,0 +1,143 @@
+#include "Core/EntityStore.hpp"
+
+#include <utility>
+
+std::uint32_t EntityStore::getRow(Entity entity) const {
+    if (entity.index >= rowOf.size() || generations[entity.index] != entity.generation)
+        return NO_ROW;
+    return rowOf[entity.index];
+}
+
+void EntityStore::reserve(std::size_t capacity) {
+    rowOf.reserve(capacity);
+    generations.reserve(capacity);
+    freeIndices.reserve(capacity);
+    entities.reserve(capacity);
+    masks.reserve(capacity);
+    positions.reserve(capacity);
+    previousPositions.reserve(capacity);
+    velocities.reserve(capacity);
+    healths.reserve(capacity);
+    sprites.reserve(capacity);
+}
+
+std::size_t EntityStore::getMemoryUsage() const {
+    auto bytes = [](const auto &column) { return column.capacity() * sizeof(column[0]); };
+    return bytes(rowOf) + bytes(generations) + bytes(freeIndices) + bytes(pendingDestroy) + bytes(entities) +
+           bytes(masks) + bytes(positions) + bytes(previousPositions) + bytes(velocities) + bytes(healths) +
+           bytes(sprites);
+}
+
+Entity EntityStore::create(ComponentMask components) {
+    std::uint32_t index;
+    if (!freeIndices.empty()) {
+        index = freeIndices.back();
+        freeIndices.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(rowOf.size());
+        rowOf.push_back(NO_ROW);
+        generations.push_back(0);
+    }
+    Entity entity{index, generations[index]};
+    rowOf[index] = static_cast<std::uint32_t>(entities.size());
+    entities.push_back(entity);
+    masks.push_back(components);
+    positions.emplace_back();
+    previousPositions.emplace_back();
+    velocities.emplace_back();
+    healths.emplace_back();
+    sprites.emplace_back();
+    return entity;
+}
+
+void EntityStore::destroy(Entity entity) {
+    std::uint32_t row = getRow(entity);
+    if (row == NO_ROW) return;
+    std::uint32_t last = static_cast<std::uint32_t>(entities.size() - 1);
+    if (row != last) {
+        entities[row] = entities[last];
+        masks[row] = masks[last];
+        positions[row] = positions[last];
+        previousPositions[row] = previousPositions[last];
+        velocities[row] = velocities[last];
+        healths[row] = healths[last];
+        sprites[row] = sprites[last];
+        rowOf[entities[row].index] = row;
+    }
+    entities.pop_back();
+    masks.pop_back();
+    positions.pop_back();
+    previousPositions.pop_back();
+    velocities.pop_back();
+    healths.pop_back();
+    sprites.pop_back();
+    rowOf[entity.index] = NO_ROW;
+    generations[entity.index]++;
+    freeIndices.push_back(entity.index);
+}
+
+void EntityStore::flushDestroyed() {
+    // Entities queued twice are stale by their second turn and are skipped.
+    for (Entity entity : pendingDestroy) destroy(entity);
+    pendingDestroy.clear();
+}
+
+void EntityStore::clear() {
+    while (!entities.empty()) destroy(entities.back());
+    pendingDestroy.clear();
+}
+
+std::size_t EntityStore::rowOfEntity(Entity entity) const {
+    std::uint32_t row = getRow(entity);
+    return row == NO_ROW ? entities.size() : row;
+}
+
+void EntityStore::addComponents(Entity entity, ComponentMask components) {
+    std::uint32_t row = getRow(entity);
+    if (row == NO_ROW) return;
+    ComponentMask added = components & ~masks[row];
+    if (added & Component::Position) positions[row] = previousPositions[row] = {};
+    if (added & Component::Velocity) velocities[row] = {};
+    if (added & Component::Health) healths[row] = {};
+    if (added & Component::Sprite) sprites[row] = {};
+    masks[row] |= components;
+}
+
+void EntityStore::removeComponents(Entity entity, ComponentMask components) {
+    std::uint32_t row = getRow(entity);
+    if (row != NO_ROW) masks[row] &= ~components;
+}
+
+bool EntityStore::hasComponents(Entity entity, ComponentMask components) const {
+    std::uint32_t row = getRow(entity);
+    return row != NO_ROW && (masks[row] & components) == components;
+}
+
+void EntityStore::setPosition(Entity entity, sf::Vector2f position) {
+    std::uint32_t row = getRow(entity);
+    if (row == NO_ROW) return;
+    positions[row] = previousPositions[row] = position;
+}
+
+void EntityStore::integrate() {
+    constexpr ComponentMask MOVING = Component::Position | Component::Velocity;
+    previousPositions = positions;
+    const std::size_t count = masks.size();
+    // Every row has a slot in every column, so this is one select and a few
+    // contiguous loads per entity, with no branch for the compiler to trip on.
+    for (std::size_t row = 0; row < count; row++) {
+        float scale = (masks[row] & MOVING) == MOVING ? 1.f : 0.f;
+        positions[row].x += velocities[row].x * scale;
+        positions[row].y += velocities[row].y * scale;
+    }
+}
+
+std::size_t EntityStore::queueDead() {
+    std::size_t queued = 0;
+    forEach(Component::Health, [&](std::size_t row) {
+        if (healths[row].current > 0.f) return;
+        pendingDestroy.push_back(entities[row]);
+        queued++;
+    });
+    return queued;
+}
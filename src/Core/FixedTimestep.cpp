@@ -0,0 +1,28 @@
+#include "Core/FixedTimestep.hpp"
+
+#include <cmath>
+
+FixedTimestep::FixedTimestep(float tickInterval, int maxTicksPerFrame)
+    : tickInterval{tickInterval},
+      maxTicksPerFrame{maxTicksPerFrame},
+      accumulator{0.f},
+      tickCount{0},
+      droppedTime{0.f} {}
+
+int FixedTimestep::advance(float elapsedSeconds) {
+    if (elapsedSeconds > 0.f) accumulator += elapsedSeconds;
+    int ticks = static_cast<int>(accumulator / tickInterval);
+    if (ticks > maxTicksPerFrame) {
+        // Too far behind: run the capped amount and forget the rest, keeping
+        // only the fractional part so interpolation stays continuous.
+        float remainder = std::fmod(accumulator, tickInterval);
+        droppedTime += accumulator - remainder - maxTicksPerFrame * tickInterval;
+        accumulator = remainder;
+        ticks = maxTicksPerFrame;
+    } else {
+        accumulator -= ticks * tickInterval;
+        if (accumulator < 0.f) accumulator = 0.f;
+    }
+    tickCount += ticks;
+    return ticks;
+}
@@ -0,0 +1,188 @@
+#include "Core/HeadlessRunner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+
+#include "Base/Constants.hpp"
+#include "Core/KeyboardState.hpp"
+#include "Utility/SignalMap.hpp"
+#include "Utility/logger.hpp"
+
+namespace {
+std::optional<sf::Mouse::Button> findMouseButton(const std::string &name) {
+    if (name == "Left") return sf::Mouse::Button::Left;
+    if (name == "Right") return sf::Mouse::Button::Right;
+    if (name == "Middle") return sf::Mouse::Button::Middle;
+    return std::nullopt;
+}
+
+std::optional<sf::Event> parseEvent(const std::string &type, std::istringstream &fields) {
+    if (type == "key_press" || type == "key_release") {
+        std::string name;
+        fields >> name;
+        Key key = SignalMap::findKey(name);
+        if (key == Key::Unknown) return std::nullopt;
+        sf::Keyboard::Key code = SignalMap::mapKeyToSfml(key);
+        if (type == "key_press") return sf::Event::KeyPressed{code};
+        return sf::Event::KeyReleased{code};
+    }
+    if (type == "mouse_press" || type == "mouse_release") {
+        std::string name;
+        sf::Vector2i position;
+        if (!(fields >> name >> position.x >> position.y)) return std::nullopt;
+        auto button = findMouseButton(name);
+        if (!button) return std::nullopt;
+        if (type == "mouse_press") return sf::Event::MouseButtonPressed{*button, position};
+        return sf::Event::MouseButtonReleased{*button, position};
+    }
+    if (type == "mouse_move") {
+        sf::Vector2i position;
+        if (!(fields >> position.x >> position.y)) return std::nullopt;
+        return sf::Event::MouseMoved{position};
+    }
+    return std::nullopt;
+}
+
+double percentile(const std::vector<double> &sorted, double fraction) {
+    if (sorted.empty()) return 0.0;
+    auto index = static_cast<std::size_t>(fraction * (sorted.size() - 1) + 0.5);
+    return sorted[index];
+}
+}  // namespace
+
+std::unique_ptr<sf::RenderTexture> HeadlessRunner::createTexture(const HeadlessOptions &options) {
+    if (!options.render || !options.useRenderTexture) return nullptr;
+    auto texture = std::make_unique<sf::RenderTexture>();
+    if (!texture->resize(options.size)) {
+        Logger::warning("Off-screen render texture unavailable, rendering to a null target");
+        return nullptr;
+    }
+    return texture;
+}
+
+HeadlessRunner::HeadlessRunner(const HeadlessOptions &options)
+    : options{options},
+      nullTarget{options.size},
+      texture{createTexture(options)},
+      target{texture ? static_cast<sf::RenderTarget &>(*texture) : nullTarget},
+      inputManager{target},
+      frameArena{GameConstants::FRAME_ARENA_BYTES},
+      jobSystem{options.jobWorkers},
+      sceneManager{target} {
+    sceneManager.setContext({&frameArena, &jobSystem});
+}
+
+HeadlessReport HeadlessRunner::run(const std::vector<ScriptedEvent> &script) {
+    HeadlessReport report;
+    const Scene *scene = sceneManager.getCurrentScene();
+    report.scene = scene != nullptr ? scene->getName() : "";
+    report.targetKind = !options.render ? "none" : texture ? "render_texture" : "null";
+    report.countedAllocations = options.countAllocations != nullptr;
+
+    std::vector<double> tickMilliseconds;
+    tickMilliseconds.reserve(options.ticks);
+    std::size_t nextEvent = 0;
+    std::optional<sf::Event> event;
+
+    using Clock = std::chrono::steady_clock;
+    const auto runStart = Clock::now();
+    for (std::uint32_t tick = 0; tick < options.ticks; tick++) {
+        const std::size_t allocationsBefore =
+            report.countedAllocations ? options.countAllocations() : 0;
+        const auto tickStart = Clock::now();
+
+        for (; nextEvent < script.size() && script[nextEvent].tick <= tick; nextEvent++) {
+            event = script[nextEvent].event;
+            inputManager.handleEvent(event);
+            sceneManager.handleEvent(event);
+        }
+        sceneManager.handleInput();
+        sceneManager.update();
+        if (options.render) {
+            target.clear(sf::Color::Black);
+            sceneManager.render(0.f);
+            if (texture) texture->display();
+        }
+        frameArena.reset();
+
+        tickMilliseconds.push_back(
+            std::chrono::duration<double, std::milli>(Clock::now() - tickStart).count());
+        if (report.countedAllocations) {
+            std::size_t allocations = options.countAllocations() - allocationsBefore;
+            report.allocations += allocations;
+            report.maxAllocationsPerTick = std::max(report.maxAllocationsPerTick, allocations);
+        }
+    }
+    report.totalSeconds = std::chrono::duration<double>(Clock::now() - runStart).count();
+    report.ticks = options.ticks;
+    if (report.totalSeconds > 0.0) report.ticksPerSecond = report.ticks / report.totalSeconds;
+
+    for (double milliseconds : tickMilliseconds) {
+        auto bucket = std::lower_bound(HeadlessReport::BUCKET_LIMITS.begin(),
+                                       HeadlessReport::BUCKET_LIMITS.end(), milliseconds);
+        report.histogram[bucket - HeadlessReport::BUCKET_LIMITS.begin()]++;
+    }
+    std::sort(tickMilliseconds.begin(), tickMilliseconds.end());
+    report.p50Milliseconds = percentile(tickMilliseconds, 0.50);
+    report.p99Milliseconds = percentile(tickMilliseconds, 0.99);
+    report.maxMilliseconds = tickMilliseconds.empty() ? 0.0 : tickMilliseconds.back();
+    return report;
+}
+
+std::vector<ScriptedEvent> HeadlessRunner::parseScript(std::istream &input) {
+    std::vector<ScriptedEvent> script;
+    std::string line;
+    for (int lineNumber = 1; std::getline(input, line); lineNumber++) {
+        std::istringstream fields(line);
+        std::uint32_t tick;
+        std::string type;
+        if (!(fields >> tick)) {
+            std::istringstream blank(line);
+            std::string first;
+            if (!(blank >> first) || first[0] == '#') continue;
+            Logger::logf(LogLevel::ERROR, "Input script line {}: missing tick", lineNumber);
+            continue;
+        }
+        fields >> type;
+        auto event = parseEvent(type, fields);
+        if (!event) {
+            Logger::logf(LogLevel::ERROR, "Input script line {}: cannot parse \"{}\"", lineNumber,
+                         line);
+            continue;
+        }
+        script.push_back({tick, *event});
+    }
+    std::stable_sort(script.begin(), script.end(),
+                     [](const ScriptedEvent &left, const ScriptedEvent &right) {
+                         return left.tick < right.tick;
+                     });
+    return script;
+}
+
+std::string HeadlessReport::toJson() const {
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(6);
+    json << "{\"scene\":\"" << scene << "\",\"target\":\"" << targetKind
+         << "\",\"ticks\":" << ticks << ",\"total_seconds\":" << totalSeconds
+         << ",\"ticks_per_second\":" << ticksPerSecond << ",\"p50_ms\":" << p50Milliseconds
+         << ",\"p99_ms\":" << p99Milliseconds << ",\"max_ms\":" << maxMilliseconds
+         << ",\"histogram\":[";
+    for (std::size_t bucket = 0; bucket < histogram.size(); bucket++) {
+        if (bucket > 0) json << ",";
+        json << "{\"le_ms\":";
+        if (bucket < BUCKET_LIMITS.size())
+            json << BUCKET_LIMITS[bucket];
+        else
+            json << "null";
+        json << ",\"count\":" << histogram[bucket] << "}";
+    }
+    json << "]";
+    if (countedAllocations)
+        json << ",\"allocations\":" << allocations
+             << ",\"max_allocations_per_tick\":" << maxAllocationsPerTick;
+    json << "}";
+    return json.str();
+}
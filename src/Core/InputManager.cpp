@@ -5,5 +5,5 @@ void InputManager::handleEvent(std::optional<sf::Event> &event) {
     keyboardState.handleEvent(event);
 }
 
-InputManager::InputManager(sf::RenderWindow &window)
-    : window{window}, mouseState{window}, keyboardState{window} {}
\ No newline at end of file
+InputManager::InputManager(sf::RenderTarget &target)
+    : target{target}, mouseState{target}, keyboardState{target} {}
\ No newline at end of file
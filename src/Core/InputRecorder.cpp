@@ -0,0 +1,313 @@
+#include "Core/InputRecorder.hpp"
+
+#include <array>
+#include <bit>
+
+#include "Utility/logger.hpp"
+
+namespace {
+constexpr std::array<char, 4> MAGIC = {'I', 'N', 'P', 'R'};
+
+/**
+ * @brief Record type bytes; values are part of the file format.
+ */
+enum RecordType : std::uint8_t {
+    CLOSED = 1,
+    RESIZED,
+    FOCUS_LOST,
+    FOCUS_GAINED,
+    TEXT_ENTERED,
+    KEY_PRESSED,
+    KEY_RELEASED,
+    MOUSE_WHEEL_SCROLLED,
+    MOUSE_BUTTON_PRESSED,
+    MOUSE_BUTTON_RELEASED,
+    MOUSE_MOVED,
+    MOUSE_ENTERED,
+    MOUSE_LEFT,
+    END = 0xFF
+};
+
+void putUnsigned(std::vector<char> &out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+void putSigned(std::vector<char> &out, std::int64_t value) {
+    // Zigzag, so small negative numbers stay short
+    putUnsigned(out, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+}
+
+void putFloat(std::vector<char> &out, float value) {
+    const auto bits = std::bit_cast<std::uint32_t>(value);
+    for (int shift = 0; shift < 32; shift += 8) out.push_back(static_cast<char>((bits >> shift) & 0xFF));
+}
+
+bool getUnsigned(std::istream &in, std::uint64_t &value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        const int byte = in.get();
+        if (byte == std::istream::traits_type::eof()) return false;
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+}
+
+bool getSigned(std::istream &in, std::int64_t &value) {
+    std::uint64_t zigzag;
+    if (!getUnsigned(in, zigzag)) return false;
+    value = static_cast<std::int64_t>(zigzag >> 1) ^ -static_cast<std::int64_t>(zigzag & 1);
+    return true;
+}
+
+bool getFloat(std::istream &in, float &value) {
+    std::uint32_t bits = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        const int byte = in.get();
+        if (byte == std::istream::traits_type::eof()) return false;
+        bits |= static_cast<std::uint32_t>(byte) << shift;
+    }
+    value = std::bit_cast<float>(bits);
+    return true;
+}
+
+bool getPosition(std::istream &in, sf::Vector2i &position) {
+    std::int64_t x, y;
+    if (!getSigned(in, x) || !getSigned(in, y)) return false;
+    position = {static_cast<int>(x), static_cast<int>(y)};
+    return true;
+}
+
+template <typename KeyEvent>
+void putKey(std::vector<char> &out, const KeyEvent &key) {
+    putSigned(out, static_cast<int>(key.code));
+    putSigned(out, static_cast<int>(key.scancode));
+    out.push_back(static_cast<char>(key.alt | key.control << 1 | key.shift << 2 | key.system << 3));
+}
+
+template <typename KeyEvent>
+bool getKey(std::istream &in, KeyEvent &key) {
+    std::int64_t code, scancode;
+    if (!getSigned(in, code) || !getSigned(in, scancode)) return false;
+    const int modifiers = in.get();
+    if (modifiers == std::istream::traits_type::eof()) return false;
+    key.code = static_cast<sf::Keyboard::Key>(code);
+    key.scancode = static_cast<sf::Keyboard::Scancode>(scancode);
+    key.alt = modifiers & 1;
+    key.control = modifiers & 2;
+    key.shift = modifiers & 4;
+    key.system = modifiers & 8;
+    return true;
+}
+
+/**
+ * @brief Encodes an event's type byte and fields.
+ * @return False if the format has no record type for the event.
+ */
+bool encode(std::vector<char> &out, const sf::Event &event) {
+    if (event.is<sf::Event::Closed>()) {
+        out.push_back(CLOSED);
+    } else if (const auto *resized = event.getIf<sf::Event::Resized>()) {
+        out.push_back(RESIZED);
+        putUnsigned(out, resized->size.x);
+        putUnsigned(out, resized->size.y);
+    } else if (event.is<sf::Event::FocusLost>()) {
+        out.push_back(FOCUS_LOST);
+    } else if (event.is<sf::Event::FocusGained>()) {
+        out.push_back(FOCUS_GAINED);
+    } else if (const auto *text = event.getIf<sf::Event::TextEntered>()) {
+        out.push_back(TEXT_ENTERED);
+        putUnsigned(out, static_cast<std::uint32_t>(text->unicode));
+    } else if (const auto *pressed = event.getIf<sf::Event::KeyPressed>()) {
+        out.push_back(KEY_PRESSED);
+        putKey(out, *pressed);
+    } else if (const auto *released = event.getIf<sf::Event::KeyReleased>()) {
+        out.push_back(KEY_RELEASED);
+        putKey(out, *released);
+    } else if (const auto *wheel = event.getIf<sf::Event::MouseWheelScrolled>()) {
+        out.push_back(MOUSE_WHEEL_SCROLLED);
+        out.push_back(static_cast<char>(wheel->wheel));
+        putFloat(out, wheel->delta);
+        putSigned(out, wheel->position.x);
+        putSigned(out, wheel->position.y);
+    } else if (const auto *buttonPressed = event.getIf<sf::Event::MouseButtonPressed>()) {
+        out.push_back(MOUSE_BUTTON_PRESSED);
+        out.push_back(static_cast<char>(buttonPressed->button));
+        putSigned(out, buttonPressed->position.x);
+        putSigned(out, buttonPressed->position.y);
+    } else if (const auto *buttonReleased = event.getIf<sf::Event::MouseButtonReleased>()) {
+        out.push_back(MOUSE_BUTTON_RELEASED);
+        out.push_back(static_cast<char>(buttonReleased->button));
+        putSigned(out, buttonReleased->position.x);
+        putSigned(out, buttonReleased->position.y);
+    } else if (const auto *moved = event.getIf<sf::Event::MouseMoved>()) {
+        out.push_back(MOUSE_MOVED);
+        putSigned(out, moved->position.x);
+        putSigned(out, moved->position.y);
+    } else if (event.is<sf::Event::MouseEntered>()) {
+        out.push_back(MOUSE_ENTERED);
+    } else if (event.is<sf::Event::MouseLeft>()) {
+        out.push_back(MOUSE_LEFT);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Decodes the fields of an event whose type byte was read.
+ */
+std::optional<sf::Event> decode(std::istream &in, int type) {
+    switch (type) {
+        case CLOSED:
+            return sf::Event::Closed{};
+        case RESIZED: {
+            std::uint64_t width, height;
+            if (!getUnsigned(in, width) || !getUnsigned(in, height)) return std::nullopt;
+            return sf::Event::Resized{{static_cast<unsigned>(width), static_cast<unsigned>(height)}};
+        }
+        case FOCUS_LOST:
+            return sf::Event::FocusLost{};
+        case FOCUS_GAINED:
+            return sf::Event::FocusGained{};
+        case TEXT_ENTERED: {
+            std::uint64_t unicode;
+            if (!getUnsigned(in, unicode)) return std::nullopt;
+            return sf::Event::TextEntered{static_cast<char32_t>(unicode)};
+        }
+        case KEY_PRESSED: {
+            sf::Event::KeyPressed key;
+            if (!getKey(in, key)) return std::nullopt;
+            return key;
+        }
+        case KEY_RELEASED: {
+            sf::Event::KeyReleased key;
+            if (!getKey(in, key)) return std::nullopt;
+            return key;
+        }
+        case MOUSE_WHEEL_SCROLLED: {
+            sf::Event::MouseWheelScrolled wheel;
+            const int axis = in.get();
+            if (axis == std::istream::traits_type::eof() || !getFloat(in, wheel.delta) ||
+                !getPosition(in, wheel.position))
+                return std::nullopt;
+            wheel.wheel = static_cast<sf::Mouse::Wheel>(axis);
+            return wheel;
+        }
+        case MOUSE_BUTTON_PRESSED:
+        case MOUSE_BUTTON_RELEASED: {
+            const int button = in.get();
+            sf::Vector2i position;
+            if (button == std::istream::traits_type::eof() || !getPosition(in, position)) return std::nullopt;
+            if (type == MOUSE_BUTTON_PRESSED)
+                return sf::Event::MouseButtonPressed{static_cast<sf::Mouse::Button>(button), position};
+            return sf::Event::MouseButtonReleased{static_cast<sf::Mouse::Button>(button), position};
+        }
+        case MOUSE_MOVED: {
+            sf::Vector2i position;
+            if (!getPosition(in, position)) return std::nullopt;
+            return sf::Event::MouseMoved{position};
+        }
+        case MOUSE_ENTERED:
+            return sf::Event::MouseEntered{};
+        case MOUSE_LEFT:
+            return sf::Event::MouseLeft{};
+        default:
+            return std::nullopt;
+    }
+}
+}  // namespace
+
+InputRecorder::~InputRecorder() {
+    if (isOpen()) close(lastTick);
+}
+
+bool InputRecorder::open(const std::filesystem::path &path, std::uint32_t tickRate) {
+    if (isOpen()) close(lastTick);
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        Logger::error("Cannot write input recording: " + path.string());
+        return false;
+    }
+    lastTick = 0;
+    recorded = 0;
+    skipped = 0;
+    buffer.clear();
+    buffer.insert(buffer.end(), MAGIC.begin(), MAGIC.end());
+    for (std::uint16_t value : {VERSION, static_cast<std::uint16_t>(tickRate)}) {
+        buffer.push_back(static_cast<char>(value & 0xFF));
+        buffer.push_back(static_cast<char>(value >> 8));
+    }
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(file);
+}
+
+void InputRecorder::record(std::uint32_t tick, const sf::Event &event) {
+    if (!isOpen()) return;
+    buffer.clear();
+    putUnsigned(buffer, tick >= lastTick ? tick - lastTick : 0);
+    if (!encode(buffer, event)) {
+        skipped++;
+        return;
+    }
+    lastTick = std::max(lastTick, tick);
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    recorded++;
+}
+
+void InputRecorder::close(std::uint32_t ticks) {
+    if (!isOpen()) return;
+    buffer.clear();
+    putUnsigned(buffer, ticks >= lastTick ? ticks - lastTick : 0);
+    buffer.push_back(static_cast<char>(END));
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    file.close();
+    if (skipped > 0)
+        Logger::logf(LogLevel::WARNING, "Input recording skipped {} events of unsupported types", skipped);
+}
+
+std::optional<InputRecording> InputRecorder::read(std::istream &input) {
+    std::array<char, 4> magic{};
+    std::array<unsigned char, 4> header{};
+    if (!input.read(magic.data(), magic.size()) || magic != MAGIC) return std::nullopt;
+    if (!input.read(reinterpret_cast<char *>(header.data()), header.size())) return std::nullopt;
+    if ((header[0] | header[1] << 8) != VERSION) return std::nullopt;
+
+    InputRecording recording;
+    recording.tickRate = header[2] | header[3] << 8;
+    std::uint32_t tick = 0;
+    while (true) {
+        std::uint64_t delta;
+        const bool hasDelta = getUnsigned(input, delta);
+        const int type = hasDelta ? input.get() : std::istream::traits_type::eof();
+        if (type == END) {
+            recording.ticks = tick + static_cast<std::uint32_t>(delta);
+            return recording;
+        }
+        std::optional<sf::Event> event;
+        if (type != std::istream::traits_type::eof()) event = decode(input, type);
+        if (!event) {
+            // Cut short, e.g. by a crash: keep what was complete and run one tick past it
+            Logger::warning("Input recording ends without an end record");
+            recording.ticks = recording.events.empty() ? 0 : tick + 1;
+            return recording;
+        }
+        tick += static_cast<std::uint32_t>(delta);
+        recording.events.push_back({tick, *event});
+    }
+}
+
+std::optional<InputRecording> InputRecorder::load(const std::filesystem::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        Logger::error("Cannot open input recording: " + path.string());
+        return std::nullopt;
+    }
+    auto recording = read(file);
+    if (!recording) Logger::error("Not an input recording of a known version: " + path.string());
+    return recording;
+}
@@ -0,0 +1,168 @@
+#include "Core/JobSystem.hpp"
+
+#include <exception>
+
+#include "Utility/Profiler.hpp"
+#include "Utility/logger.hpp"
+
+namespace {
+thread_local const JobSystem *currentSystem = nullptr; ///< System the calling thread works for.
+thread_local std::size_t currentQueue = 0;             ///< Queue of the calling thread in currentSystem.
+thread_local std::uint32_t stealSeed = 0x9E3779B9u;    ///< Xorshift state for picking victims.
+
+std::uint32_t nextRandom() {
+    stealSeed ^= stealSeed << 13;
+    stealSeed ^= stealSeed >> 17;
+    stealSeed ^= stealSeed << 5;
+    return stealSeed;
+}
+}  // namespace
+
+JobSystem::JobSystem(std::size_t workerCount) {
+    for (std::size_t index = 0; index <= workerCount; index++) queues.push_back(std::make_unique<WorkQueue>());
+    workers.reserve(workerCount);
+    for (std::size_t index = 0; index < workerCount; index++)
+        workers.emplace_back(&JobSystem::workerLoop, this, index);
+}
+
+JobSystem::~JobSystem() {
+    // Jobs own their captures, so finish them rather than leak them
+    while (tryRunJob(queues.size() - 1)) {
+    }
+    stopping.store(true);
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    wakeUp.notify_all();
+    for (auto &worker : workers) worker.join();
+}
+
+std::size_t JobSystem::defaultWorkerCount() {
+    unsigned hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+}
+
+std::size_t JobSystem::ownQueue() const { return currentSystem == this ? currentQueue : queues.size() - 1; }
+
+void JobSystem::push(const Job &job) {
+    // Count first, so the count never drops below the jobs actually queued
+    queuedJobs.fetch_add(1);
+    WorkQueue &queue = *queues[ownQueue()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(job);
+    }
+    // Pairs with the increment of sleepingWorkers in workerLoop: one side sees the other
+    if (sleepingWorkers.load() > 0) {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        wakeUp.notify_one();
+    }
+}
+
+bool JobSystem::tryRunJob(std::size_t own) {
+    Job job{};
+    bool found = false;
+    {
+        WorkQueue &queue = *queues[own];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            job = queue.jobs.back();
+            queue.jobs.pop_back();
+            found = true;
+        }
+    }
+    if (!found && queuedJobs.load(std::memory_order_relaxed) > 0) {
+        const std::size_t count = queues.size();
+        const std::size_t first = nextRandom() % count;
+        for (std::size_t offset = 0; offset < count && !found; offset++) {
+            const std::size_t victim = (first + offset) % count;
+            if (victim == own) continue;
+            WorkQueue &queue = *queues[victim];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.jobs.empty()) continue;
+            job = queue.jobs.front();
+            queue.jobs.pop_front();
+            found = true;
+        }
+        if (found) steals.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (!found) return false;
+    queuedJobs.fetch_sub(1);
+    execute(job);
+    return true;
+}
+
+void JobSystem::execute(const Job &job) {
+    try {
+        job.function(job.context, job.begin, job.end);
+    } catch (const std::exception &exception) {
+        Logger::error(std::string("Job threw: ") + exception.what());
+    } catch (...) {
+        Logger::error("Job threw a non-standard exception");
+    }
+    job.counter->pending.fetch_sub(1, std::memory_order_release);
+}
+
+void JobSystem::wait(JobCounter &counter) {
+    const std::size_t own = ownQueue();
+    while (!counter.isDone()) {
+        // The remaining jobs may be running elsewhere; let their threads have the core
+        if (!tryRunJob(own)) std::this_thread::yield();
+    }
+}
+
+void JobSystem::workerLoop(std::size_t index) {
+    PROFILE_THREAD_NAME("Job worker");
+    currentSystem = this;
+    currentQueue = index;
+    stealSeed += static_cast<std::uint32_t>(index) * 0x85EBCA6Bu;
+    while (true) {
+        // Spin briefly before sleeping: jobs of a tick tend to arrive in bursts
+        bool ran = false;
+        for (int attempt = 0; attempt < 64 && !ran; attempt++) {
+            ran = tryRunJob(index);
+            if (!ran) std::this_thread::yield();
+        }
+        if (ran) continue;
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepingWorkers.fetch_add(1);
+        wakeUp.wait(lock, [this]() { return stopping.load() || queuedJobs.load() > 0; });
+        sleepingWorkers.fetch_sub(1);
+        if (stopping.load()) return;
+    }
+}
+
+TaskGraph::TaskId TaskGraph::add(std::function<void()> work) {
+    tasks.push_back(std::make_unique<Task>());
+    tasks.back()->work = std::move(work);
+    return tasks.size() - 1;
+}
+
+void TaskGraph::precede(TaskId before, TaskId after) {
+    tasks[before]->successors.push_back(after);
+    tasks[after]->predecessors++;
+}
+
+void TaskGraph::start(TaskId task) {
+    system->submit(
+        [this, task]() {
+            Task &current = *tasks[task];
+            current.work();
+            // Start successors before this job counts as finished, so run() cannot return early
+            for (TaskId successor : current.successors)
+                if (tasks[successor]->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) start(successor);
+        },
+        counter);
+}
+
+void TaskGraph::run(JobSystem &jobSystem) {
+    PROFILE_SCOPE("TaskGraph::run");
+    system = &jobSystem;
+    for (auto &task : tasks) task->remaining.store(task->predecessors, std::memory_order_relaxed);
+    for (TaskId task = 0; task < tasks.size(); task++)
+        if (tasks[task]->predecessors == 0) start(task);
+    jobSystem.wait(counter);
+    system = nullptr;
+}
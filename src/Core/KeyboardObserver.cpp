@@ -1,9 +1,9 @@
 #include "Core/KeyboardObserver.hpp"
 
 #include "Core/KeyboardState.hpp"
-void KeyboardObserver::subscribeKeyboard(Key key, UserEvent event,
-                                 KeyboardState &state) {
-    state.addSubscriber(key, event, this);
+SubscriptionHandle KeyboardObserver::subscribeKeyboard(Key key, UserEvent event,
+                                                      KeyboardState &state) {
+    return state.addSubscriber(key, event, this);
 }
 
 void KeyboardObserver::unSubscribeKeyboard(Key key, UserEvent event,
@@ -1,68 +1,77 @@
 #include "Core/KeyboardState.hpp"
 
-#include <algorithm>
-#include <list>
-#include <map>
 #include <optional>
 
 #include "Core/KeyboardObserver.hpp"
 #include "Core/UserEvent.hpp"
 #include "Utility/logger.hpp"
 #include "Utility/SignalMap.hpp"
-void KeyboardState::addSubscriber(Key key, UserEvent event,
-                                  KeyboardObserver* subscriber) {
-    std::list<KeyboardObserver*>& subscribers = subscriberList[key][event];
-    if (std::find(subscribers.begin(), subscribers.end(), subscriber) ==
-        subscribers.end()) {
-        subscribers.push_back(subscriber);
-        return;
+ObserverList<KeyboardObserver>& KeyboardState::getList(Key key, UserEvent event) {
+    return subscriberList[static_cast<std::size_t>(key)]
+                         [static_cast<std::size_t>(event)];
+}
+
+SubscriptionHandle KeyboardState::addSubscriber(Key key, UserEvent event,
+                                                KeyboardObserver* subscriber) {
+    auto& subscribers = getList(key, event);
+    if (subscribers.contains(subscriber)) {
+        Logger::error("Inserting existed subscriber");
+        return {};
     }
-    Logger::error("Inserting existed subscriber");
-    return;
+    SubscriptionHandle handle = subscribers.add(subscriber);
+    handle.list = static_cast<std::uint32_t>(static_cast<std::size_t>(key) * EVENT_COUNT +
+                                             static_cast<std::size_t>(event));
+    return handle;
 }
 
 void KeyboardState::removeSubscriber(Key key, UserEvent event,
                                      KeyboardObserver* subscriber) {
-    auto& subscribers = subscriberList[key][event];
-    auto place = std::find(subscribers.begin(), subscribers.end(), subscriber);
-    if (place == subscribers.end()) {
+    if (!getList(key, event).remove(subscriber))
         Logger::error("Unsubscribing non-exist subscriber");
-        return;
-    }
-    subscribers.erase(place);
+}
+
+void KeyboardState::removeSubscriber(const SubscriptionHandle& handle) {
+    if (handle.list >= KEY_COUNT * EVENT_COUNT ||
+        !subscriberList[handle.list / EVENT_COUNT][handle.list % EVENT_COUNT].remove(handle))
+        Logger::error("Unsubscribing with a stale keyboard handle");
 }
 
 void KeyboardState::clearSubscriber(Key key, UserEvent event) {
-    auto& subscribers = subscriberList[key][event];
-    subscribers.clear();
+    getList(key, event).clear();
 }
 
 void KeyboardState::clearSubscriber() {
-    for (auto [key, eventMap] : subscriberList)
-        for (auto [event, subscribers] : eventMap) subscribers.clear();
+    for (auto& eventLists : subscriberList)
+        for (auto& subscribers : eventLists) subscribers.clear();
 }
 
 void KeyboardState::handleEvent(std::optional<sf::Event>& event) {
-    auto keyPress = event->getIf<sf::Event::KeyPressed>();
-    auto keyRelease = event->getIf<sf::Event::KeyReleased>();
-    auto windowPosition = sf::Mouse::getPosition(window);
-    auto worldPosititon = window.mapPixelToCoords(windowPosition);
-    if (keyPress) {
-        Key key = SignalMap::mapSfmlKey(keyPress->code);
-        for (auto subscriber : subscriberList[key][UserEvent::Press]) {
-            subscriber->onKeyEvent(key, UserEvent::Press, worldPosititon,
-                                   windowPosition);
-        }
-        return;
-    }
-    if (keyRelease) {
-        Key key = SignalMap::mapSfmlKey(keyRelease->code);
-        for (auto subscriber : subscriberList[key][UserEvent::Release]) {
-            subscriber->onKeyEvent(key, UserEvent::Release, worldPosititon,
-                                   windowPosition);
-        }
+    Key key;
+    UserEvent userEvent;
+    if (auto keyPress = event->getIf<sf::Event::KeyPressed>()) {
+        key = SignalMap::mapSfmlKey(keyPress->code);
+        userEvent = UserEvent::Press;
+    } else if (auto keyRelease = event->getIf<sf::Event::KeyReleased>()) {
+        key = SignalMap::mapSfmlKey(keyRelease->code);
+        userEvent = UserEvent::Release;
+    } else {
+        // Track the cursor from events so key callbacks do not query the OS
+        // and work without a real window.
+        if (auto mouseMove = event->getIf<sf::Event::MouseMoved>())
+            mousePosition = mouseMove->position;
+        else if (auto mousePress = event->getIf<sf::Event::MouseButtonPressed>())
+            mousePosition = mousePress->position;
+        else if (auto mouseRelease = event->getIf<sf::Event::MouseButtonReleased>())
+            mousePosition = mouseRelease->position;
         return;
     }
+    auto& subscribers = getList(key, userEvent);
+    if (subscribers.empty()) return;
+    auto windowPosition = mousePosition;
+    auto worldPosititon = target.mapPixelToCoords(windowPosition);
+    subscribers.forEach([&](KeyboardObserver* subscriber) {
+        subscriber->onKeyEvent(key, userEvent, worldPosititon, windowPosition);
+    });
 }
 
-KeyboardState::KeyboardState(sf::RenderWindow& window) : window{window} {}
\ No newline at end of file
+KeyboardState::KeyboardState(sf::RenderTarget& target) : target{target} {}
\ No newline at end of file
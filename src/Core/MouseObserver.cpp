@@ -1,9 +1,15 @@
 #include "Core/MouseObserver.hpp"
 
 #include "Core/MouseState.hpp"
-void MouseObserver::subscribeMouse(Mouse button, UserEvent event,
-                              MouseState &mouseState) {
-    mouseState.addSubscriber(button, event, this);
+SubscriptionHandle MouseObserver::subscribeMouse(Mouse button, UserEvent event,
+                                                MouseState &mouseState) {
+    return mouseState.addSubscriber(button, event, this);
+}
+
+SubscriptionHandle MouseObserver::subscribeMouse(Mouse button, UserEvent event,
+                                                MouseState &mouseState,
+                                                const MouseRegion &region) {
+    return mouseState.addSubscriber(button, event, this, region);
 }
 
 void MouseObserver::unSubscribeMouse(Mouse button, UserEvent event, 
@@ -1,73 +1,211 @@
 #include "Core/MouseState.hpp"
 
 #include <algorithm>
-#include <list>
-#include <sstream>
 #include <utility>
 
 #include "Core/MouseObserver.hpp"
 #include "Utility/logger.hpp"
 #include "Utility/SignalMap.hpp"
-void MouseState::addSubscriber(Mouse button, UserEvent event,
-                               MouseObserver* subscriber) {
-    if (std::find(subscriberList[button][event].begin(),
-                  subscriberList[button][event].end(),
-                  subscriber) == subscriberList[button][event].end()) {
-        subscriberList[button][event].push_back(subscriber);
-        Logger::success(
-            Logger::messageAddress("Added mouse subscriber", subscriber));
+ObserverList<MouseObserver>& MouseState::getList(Mouse button,
+                                                 UserEvent event) {
+    return subscriberList[static_cast<std::size_t>(button)]
+                         [static_cast<std::size_t>(event)];
+}
 
-    } else {
+MouseState::HitLayer& MouseState::getLayer(Mouse button, UserEvent event) {
+    return hitLayers[static_cast<std::size_t>(button)]
+                    [static_cast<std::size_t>(event)];
+}
+
+SubscriptionHandle MouseState::addSubscriber(Mouse button, UserEvent event,
+                                             MouseObserver* subscriber) {
+    auto& subscribers = getList(button, event);
+    if (subscribers.contains(subscriber)) {
         Logger::error(Logger::messageAddress("Adding existing mouse subscriber",
                                              subscriber));
+        return {};
+    }
+    SubscriptionHandle handle = subscribers.add(subscriber);
+    handle.list = static_cast<std::uint32_t>(
+        static_cast<std::size_t>(button) * EVENT_COUNT +
+        static_cast<std::size_t>(event));
+    Logger::success(
+        Logger::messageAddress("Added mouse subscriber", subscriber));
+    return handle;
+}
+
+SubscriptionHandle MouseState::addSubscriber(Mouse button, UserEvent event,
+                                             MouseObserver* subscriber,
+                                             const MouseRegion& region) {
+    HitLayer& layer = getLayer(button, event);
+    std::uint32_t slot;
+    if (!layer.freeSlots.empty()) {
+        slot = layer.freeSlots.back();
+        layer.freeSlots.pop_back();
+    } else {
+        slot = static_cast<std::uint32_t>(layer.subscribers.size());
+        layer.subscribers.emplace_back();
+    }
+    BoundedSubscriber& entry = layer.subscribers[slot];
+    entry.observer = subscriber;
+    entry.region = region;
+    entry.order = subscriptionCounter++;
+    auto& index = region.space == MouseSpace::Screen ? layer.screenIndex
+                                                     : layer.worldIndex;
+    index.insert(slot, region.bounds);
+
+    std::uint32_t list = static_cast<std::uint32_t>(
+        static_cast<std::size_t>(button) * EVENT_COUNT +
+        static_cast<std::size_t>(event));
+    Logger::success(
+        Logger::messageAddress("Added bounded mouse subscriber", subscriber));
+    return {static_cast<std::uint32_t>(LIST_COUNT + list), slot,
+            entry.generation};
+}
+
+void MouseState::releaseBounded(HitLayer& layer, std::uint32_t slot) {
+    BoundedSubscriber& entry = layer.subscribers[slot];
+    auto& index = entry.region.space == MouseSpace::Screen ? layer.screenIndex
+                                                           : layer.worldIndex;
+    index.remove(slot);
+    entry.observer = nullptr;
+    entry.generation++;
+    layer.freeSlots.push_back(slot);
+}
+
+void MouseState::setSubscriberBounds(const SubscriptionHandle& handle,
+                                     const sf::FloatRect& bounds) {
+    std::size_t list = handle.list - LIST_COUNT;
+    if (handle.list < LIST_COUNT || list >= LIST_COUNT) {
+        Logger::error("Setting bounds through a mouse handle without a region");
+        return;
     }
+    HitLayer& layer = hitLayers[list / EVENT_COUNT][list % EVENT_COUNT];
+    if (handle.slot >= layer.subscribers.size() ||
+        layer.subscribers[handle.slot].observer == nullptr ||
+        layer.subscribers[handle.slot].generation != handle.generation) {
+        Logger::error("Setting bounds through a stale mouse handle");
+        return;
+    }
+    BoundedSubscriber& entry = layer.subscribers[handle.slot];
+    entry.region.bounds = bounds;
+    auto& index = entry.region.space == MouseSpace::Screen ? layer.screenIndex
+                                                           : layer.worldIndex;
+    index.update(handle.slot, bounds);
 }
 
 void MouseState::removeSubscriber(Mouse button, UserEvent event,
                                   MouseObserver* subscriber) {
-    auto foundIterator =
-        std::find(subscriberList[button][event].begin(),
-                  subscriberList[button][event].end(), subscriber);
+    bool removed = getList(button, event).remove(subscriber);
+    HitLayer& layer = getLayer(button, event);
+    for (std::uint32_t slot = 0; slot < layer.subscribers.size(); slot++) {
+        if (layer.subscribers[slot].observer != subscriber) continue;
+        releaseBounded(layer, slot);
+        removed = true;
+    }
+    if (!removed) Logger::error("Removing non-existent subscriber");
+}
 
-    if (foundIterator == subscriberList[button][event].end()) {
-        Logger::error("Removing non-existent subscriber");
+void MouseState::removeSubscriber(const SubscriptionHandle& handle) {
+    if (handle.list < LIST_COUNT) {
+        if (!subscriberList[handle.list / EVENT_COUNT][handle.list % EVENT_COUNT]
+                 .remove(handle))
+            Logger::error("Removing subscriber with a stale mouse handle");
+        return;
+    }
+    std::size_t list = handle.list - LIST_COUNT;
+    if (list >= LIST_COUNT) {
+        Logger::error("Removing subscriber with a stale mouse handle");
+        return;
+    }
+    HitLayer& layer = hitLayers[list / EVENT_COUNT][list % EVENT_COUNT];
+    if (handle.slot >= layer.subscribers.size() ||
+        layer.subscribers[handle.slot].observer == nullptr ||
+        layer.subscribers[handle.slot].generation != handle.generation) {
+        Logger::error("Removing subscriber with a stale mouse handle");
         return;
     }
-    subscriberList[button][event].erase(foundIterator);
+    releaseBounded(layer, handle.slot);
 }
 
 void MouseState::clearSubscriber() {
-    for (auto [button, eventStorage] : subscriberList) {
-        for (auto [event, observer] : eventStorage) observer.clear();
-    }
+    for (std::size_t button = 0; button < BUTTON_COUNT; button++)
+        for (std::size_t event = 0; event < EVENT_COUNT; event++)
+            clearSubscriber(static_cast<Mouse>(button),
+                            static_cast<UserEvent>(event));
 }
 
 void MouseState::clearSubscriber(Mouse button, UserEvent event) {
-    subscriberList[button][event].clear();
+    getList(button, event).clear();
+    HitLayer& layer = getLayer(button, event);
+    for (std::uint32_t slot = 0; slot < layer.subscribers.size(); slot++)
+        if (layer.subscribers[slot].observer != nullptr)
+            releaseBounded(layer, slot);
+}
+
+void MouseState::dispatch(Mouse button, UserEvent event,
+                          sf::Vector2i windowPosition) {
+    sf::Vector2f worldPosition = target.mapPixelToCoords(windowPosition);
+    HitLayer& layer = getLayer(button, event);
+
+    // Each hit remembers its slot's generation, so a slot that a callback
+    // frees and another subscription reuses mid-dispatch is skipped. The
+    // scratch vector is taken out of the member so a callback that dispatches
+    // again cannot clobber it.
+    std::vector<std::uint64_t> hits = std::move(hitScratch);
+    hits.clear();
+    auto collect = [&](const std::vector<std::uint32_t>& slots) {
+        for (std::uint32_t slot : slots)
+            hits.push_back(
+                static_cast<std::uint64_t>(layer.subscribers[slot].generation) << 32 |
+                slot);
+    };
+    sf::Vector2f screenPoint{static_cast<float>(windowPosition.x),
+                             static_cast<float>(windowPosition.y)};
+    layer.screenIndex.queryRect({screenPoint, {0.f, 0.f}}, queryScratch);
+    collect(queryScratch);
+    layer.worldIndex.queryRect({worldPosition, {0.f, 0.f}}, queryScratch);
+    collect(queryScratch);
+
+    bool consumed = false;
+    if (!hits.empty()) {
+        std::sort(hits.begin(), hits.end(),
+                  [&](std::uint64_t left, std::uint64_t right) {
+                      const auto& a = layer.subscribers[static_cast<std::uint32_t>(left)];
+                      const auto& b = layer.subscribers[static_cast<std::uint32_t>(right)];
+                      if (a.region.zOrder != b.region.zOrder)
+                          return a.region.zOrder > b.region.zOrder;
+                      return a.order < b.order;
+                  });
+        for (std::size_t index = 0; index < hits.size() && !consumed; index++) {
+            auto slot = static_cast<std::uint32_t>(hits[index]);
+            auto generation = static_cast<std::uint32_t>(hits[index] >> 32);
+            const BoundedSubscriber& entry = layer.subscribers[slot];
+            if (entry.observer == nullptr || entry.generation != generation)
+                continue;
+            consumed = entry.observer->onMouseHit(button, event, worldPosition,
+                                                  windowPosition);
+        }
+    }
+    hitScratch = std::move(hits);
+    if (consumed) return;
+
+    getList(button, event).forEach([&](MouseObserver* observer) {
+        observer->onMouseEvent(button, event, worldPosition, windowPosition);
+    });
 }
 
 void MouseState::handleEvent(const std::optional<sf::Event>& event) {
-    const auto mouseClickEvent = event->getIf<sf::Event::MouseButtonPressed>();
-    const auto mouseReleaseEvent =
-        event->getIf<sf::Event::MouseButtonReleased>();
-    if (mouseClickEvent) {
-        sf::Vector2i windowPosition = mouseClickEvent->position;
-        sf::Vector2f worldPosition = window.mapPixelToCoords(windowPosition);
-        
-        Mouse pressedButton = SignalMap::mapSfmlMouseButton(mouseClickEvent->button);
-        for (MouseObserver* observer: subscriberList[pressedButton][UserEvent::Press])
-            observer->onMouseEvent(pressedButton, UserEvent::Press, worldPosition, windowPosition);
+    if (const auto press = event->getIf<sf::Event::MouseButtonPressed>()) {
+        dispatch(SignalMap::mapSfmlMouseButton(press->button), UserEvent::Press,
+                 press->position);
         return;
     }
-    if (mouseReleaseEvent) {
-        sf::Vector2i windowPosition = mouseReleaseEvent->position;
-        sf::Vector2f worldPosition = window.mapPixelToCoords(windowPosition);
-        
-        Mouse pressedButton = SignalMap::mapSfmlMouseButton(mouseReleaseEvent->button);
-        for (MouseObserver* observer: subscriberList[pressedButton][UserEvent::Release])
-            observer->onMouseEvent(pressedButton, UserEvent::Release, worldPosition, windowPosition);
+    if (const auto release = event->getIf<sf::Event::MouseButtonReleased>()) {
+        dispatch(SignalMap::mapSfmlMouseButton(release->button),
+                 UserEvent::Release, release->position);
         return;
     }
 }
 
-MouseState::MouseState(sf::RenderWindow& window) : window{window} {}
\ No newline at end of file
+MouseState::MouseState(sf::RenderTarget& target) : target{target} {}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "Core/MusicPlayer.hpp"
+
+#include <algorithm>
+
+#include "Core/AssetPack.hpp"
+#include "Utility/logger.hpp"
+
+MusicPlayer::MusicPlayer(const AssetPack &pack, MusicConfig config) : pack(pack), config(config) {
+    for (Track &track : tracks) track.stream = std::make_unique<MusicStream>(config.memoryCapBytes / tracks.size());
+}
+
+bool MusicPlayer::play(const std::string &path, sf::Time fade, bool loop) {
+    Track &playing = tracks[current];
+    if (playing.path == path) {
+        // Already current; only undo a fade-out started by stop()
+        if (playing.fadeRate < 0.f) {
+            playing.fadeRate = fade > sf::Time::Zero ? 1.f / fade.asSeconds() : 0.f;
+            if (fade <= sf::Time::Zero) playing.gain = 1.f;
+            applyVolume(playing);
+        }
+        return true;
+    }
+
+    Track &next = tracks[1 - current];
+    if (next.path == path && fade > sf::Time::Zero) {
+        // Switching back while the track is still fading out: fade it back in from where it is
+        fadeOut(playing, fade);
+        next.fadeRate = 1.f / fade.asSeconds();
+        current = 1 - current;
+        return true;
+    }
+    std::span<const std::byte> packed = pack.findPath(path);
+    bool opened = packed.data() != nullptr ? next.stream->openFromMemory(packed) : next.stream->openFromFile(assetRoot / path);
+    if (!opened) {
+        Logger::error("Failed to open music: " + path);
+        next.path.clear();
+        return false;
+    }
+
+    fadeOut(playing, fade);
+    next.path = path;
+    next.gain = fade > sf::Time::Zero ? 0.f : 1.f;
+    next.fadeRate = fade > sf::Time::Zero ? 1.f / fade.asSeconds() : 0.f;
+    next.stream->setLooping(loop);
+    applyVolume(next);
+    next.stream->play();
+    current = 1 - current;
+    return true;
+}
+
+void MusicPlayer::stop(sf::Time fade) { fadeOut(tracks[current], fade); }
+
+void MusicPlayer::fadeOut(Track &track, sf::Time fade) {
+    if (track.path.empty()) return;
+    if (fade <= sf::Time::Zero || track.gain <= 0.f) {
+        track.stream->stop();
+        track.path.clear();
+        track.gain = 0.f;
+        track.fadeRate = 0.f;
+        return;
+    }
+    // Fading from the current gain keeps an interrupted fade-in continuous
+    track.fadeRate = -1.f / fade.asSeconds();
+}
+
+void MusicPlayer::update(sf::Time elapsed) {
+    for (Track &track : tracks) {
+        if (track.path.empty()) continue;
+        if (track.stream->getStatus() == sf::SoundSource::Status::Stopped) {
+            // A track that is not looping ended by itself
+            track.path.clear();
+            track.fadeRate = 0.f;
+            continue;
+        }
+        if (track.fadeRate == 0.f) continue;
+        track.gain = std::clamp(track.gain + track.fadeRate * elapsed.asSeconds(), 0.f, 1.f);
+        if (track.gain <= 0.f) {
+            fadeOut(track, sf::Time::Zero);
+            continue;
+        }
+        if (track.gain >= 1.f) track.fadeRate = 0.f;
+        applyVolume(track);
+    }
+}
+
+void MusicPlayer::setVolume(float volume) {
+    config.volume = std::clamp(volume, 0.f, 100.f);
+    for (Track &track : tracks)
+        if (!track.path.empty()) applyVolume(track);
+}
+
+void MusicPlayer::applyVolume(Track &track) { track.stream->setVolume(config.volume * track.gain); }
+
+std::size_t MusicPlayer::getBufferBytes() const {
+    std::size_t bytes = 0;
+    for (const Track &track : tracks) bytes += track.stream->getBufferBytes();
+    return bytes;
+}
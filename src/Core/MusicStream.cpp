@@ -0,0 +1,53 @@
+#include "Core/MusicStream.hpp"
+
+#include <algorithm>
+
+MusicStream::MusicStream(std::size_t bufferBytes)
+    : buffer(std::max<std::size_t>(bufferBytes / sizeof(std::int16_t), 1024)) {}
+
+MusicStream::~MusicStream() {
+    // The streaming thread must not read the decoder while it is destroyed
+    stop();
+}
+
+bool MusicStream::openFromFile(const std::filesystem::path &path) {
+    stop();
+    std::lock_guard<std::mutex> lock(mutex);
+    return file.openFromFile(path) && start();
+}
+
+bool MusicStream::openFromMemory(std::span<const std::byte> data) {
+    stop();
+    std::lock_guard<std::mutex> lock(mutex);
+    return file.openFromMemory(data.data(), data.size()) && start();
+}
+
+bool MusicStream::start() {
+    const unsigned channels = file.getChannelCount();
+    if (channels == 0 || channels > buffer.size()) return false;
+    chunkSamples = buffer.size() / channels * channels;
+    samplesDecoded = 0;
+    initialize(channels, file.getSampleRate(), file.getChannelMap());
+    return true;
+}
+
+bool MusicStream::onGetData(Chunk &data) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const std::uint64_t count = file.read(buffer.data(), chunkSamples);
+    samplesDecoded += count;
+    data.samples = buffer.data();
+    data.sampleCount = static_cast<std::size_t>(count);
+    // A short read means the track ended; SFML then loops or stops the stream
+    return count == chunkSamples;
+}
+
+void MusicStream::onSeek(sf::Time timeOffset) {
+    std::lock_guard<std::mutex> lock(mutex);
+    file.seek(timeOffset);
+    samplesDecoded = 0;
+}
+
+std::uint64_t MusicStream::getSamplesDecoded() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return samplesDecoded;
+}
@@ -0,0 +1,121 @@
+#include "Core/RenderQueue.hpp"
+
+#include <algorithm>
+
+#include "Core/EntityStore.hpp"
+#include "Core/ResourceManager.hpp"
+#include "Utility/Profiler.hpp"
+
+void RenderQueue::reserve(std::size_t quadCount) {
+    quads.reserve(quadCount);
+    keys.reserve(quadCount);
+    vertices.reserve(quadCount * 6);
+}
+
+void RenderQueue::push(TextureHandle texture, const sf::Vector2f (&corners)[4], sf::IntRect textureRect,
+                       sf::Color color, std::int16_t layer) {
+    constexpr std::uint64_t TEXTURE_LIMIT = (std::uint64_t{1} << TEXTURE_BITS) - 1;
+    if (quads.size() >= MAX_QUADS || (texture.isValid() && texture.index >= TEXTURE_LIMIT)) {
+        dropped++;
+        return;
+    }
+    // Flipping the sign bit makes signed layers sort as unsigned; slot 0 is "no texture"
+    const std::uint64_t layerBits = static_cast<std::uint16_t>(layer) ^ 0x8000u;
+    const std::uint64_t textureSlot = texture.isValid() ? texture.index + std::uint64_t{1} : 0;
+    keys.push_back(layerBits << (TEXTURE_BITS + INDEX_BITS) | textureSlot << INDEX_BITS | quads.size());
+    quads.push_back({texture,
+                     {corners[0], corners[1], corners[2], corners[3]},
+                     sf::FloatRect(textureRect),
+                     color});
+}
+
+void RenderQueue::submit(TextureHandle texture, const sf::Transform &transform, sf::IntRect textureRect,
+                         sf::Color color, std::int16_t layer) {
+    const sf::Vector2f size(textureRect.size);
+    const sf::Vector2f corners[4] = {transform.transformPoint({0.f, 0.f}),
+                                     transform.transformPoint({size.x, 0.f}),
+                                     transform.transformPoint({0.f, size.y}),
+                                     transform.transformPoint(size)};
+    push(texture, corners, textureRect, color, layer);
+}
+
+void RenderQueue::submit(TextureHandle texture, sf::Vector2f position, sf::IntRect textureRect,
+                         sf::Color color, std::int16_t layer) {
+    const sf::Vector2f size(textureRect.size);
+    const sf::Vector2f corners[4] = {position,
+                                     {position.x + size.x, position.y},
+                                     {position.x, position.y + size.y},
+                                     position + size};
+    push(texture, corners, textureRect, color, layer);
+}
+
+void RenderQueue::submit(const SpriteFrame &sprite, sf::Vector2f position, sf::Color color, std::int16_t layer) {
+    submit(sprite.texture, position, sprite.rect, color, layer);
+}
+
+void RenderQueue::submit(const EntityStore &entities, float alpha) {
+    std::span<const ComponentMask> masks = entities.getMasks();
+    std::span<const SpriteComponent> sprites = entities.getSprites();
+    constexpr ComponentMask required = Component::Position | Component::Sprite;
+    for (std::size_t row = 0; row < masks.size(); row++) {
+        if ((masks[row] & required) != required) continue;
+        const SpriteComponent &sprite = sprites[row];
+        submit(sprite.texture, entities.getInterpolatedPosition(row, alpha), sprite.textureRect, sprite.color,
+               sprite.layer);
+    }
+}
+
+void RenderQueue::flush(sf::RenderTarget &target, sf::RenderStates states) {
+    PROFILE_SCOPE("RenderQueue::flush");
+    stats = RenderStats{};
+    stats.quads = quads.size() + dropped;
+    stats.skippedQuads = dropped;
+
+    std::sort(keys.begin(), keys.end());
+
+    // Append each quad's triangles, drawing the pending run whenever the texture changes
+    constexpr std::uint64_t INDEX_MASK = (std::uint64_t{1} << INDEX_BITS) - 1;
+    vertices.clear();
+    std::size_t batchStart = 0;
+    TextureHandle batchTexture;
+    const sf::Texture *batchPointer = nullptr;
+    auto drawBatch = [&]() {
+        if (vertices.size() == batchStart) return;
+        states.texture = batchPointer;
+        target.draw(vertices.data() + batchStart, vertices.size() - batchStart, sf::PrimitiveType::Triangles,
+                    states);
+        stats.drawCalls++;
+        batchStart = vertices.size();
+    };
+
+    bool first = true;
+    for (std::uint64_t key : keys) {
+        const Quad &quad = quads[key & INDEX_MASK];
+        if (first || quad.texture != batchTexture) {
+            drawBatch();
+            first = false;
+            batchTexture = quad.texture;
+            batchPointer = quad.texture.isValid() ? resources.getTexture(quad.texture) : nullptr;
+        }
+        if (quad.texture.isValid() && batchPointer == nullptr) {
+            stats.skippedQuads++;
+            continue;
+        }
+        const sf::Vector2f uv = quad.textureRect.position;
+        const sf::Vector2f uvEnd = quad.textureRect.position + quad.textureRect.size;
+        const sf::Vertex topLeft{quad.corners[0], quad.color, uv};
+        const sf::Vertex topRight{quad.corners[1], quad.color, {uvEnd.x, uv.y}};
+        const sf::Vertex bottomLeft{quad.corners[2], quad.color, {uv.x, uvEnd.y}};
+        const sf::Vertex bottomRight{quad.corners[3], quad.color, uvEnd};
+        vertices.insert(vertices.end(), {topLeft, topRight, bottomLeft, bottomLeft, topRight, bottomRight});
+    }
+    drawBatch();
+    stats.vertices = vertices.size();
+    clear();
+}
+
+void RenderQueue::clear() {
+    quads.clear();
+    keys.clear();
+    dropped = 0;
+}
@@ -0,0 +1,44 @@
+#include "Core/RenderSnapshot.hpp"
+
+#include "Core/EntityStore.hpp"
+#include "Core/RenderQueue.hpp"
+#include "Core/ResourceManager.hpp"
+#include "Utility/Profiler.hpp"
+
+void RenderSnapshot::clear() {
+    tick = 0;
+    clearColor = sf::Color::Black;
+    sprites.clear();
+    texts.clear();
+}
+
+void RenderSnapshot::addEntities(const EntityStore &entities) {
+    std::span<const ComponentMask> masks = entities.getMasks();
+    std::span<const SpriteComponent> entitySprites = entities.getSprites();
+    std::span<const sf::Vector2f> positions = entities.getPositions();
+    std::span<const sf::Vector2f> previousPositions = entities.getPreviousPositions();
+    constexpr ComponentMask required = Component::Position | Component::Sprite;
+    for (std::size_t row = 0; row < masks.size(); row++) {
+        if ((masks[row] & required) != required) continue;
+        const SpriteComponent &sprite = entitySprites[row];
+        sprites.push_back({sprite.texture, sprite.textureRect, previousPositions[row], positions[row], sprite.color,
+                           sprite.layer});
+    }
+}
+
+void RenderSnapshot::draw(sf::RenderTarget &target, RenderQueue &queue, const ResourceManager &resources,
+                          float alpha) const {
+    PROFILE_SCOPE("RenderSnapshot::draw");
+    for (const SnapshotSprite &sprite : sprites)
+        queue.submit(sprite.texture, sprite.previous + (sprite.current - sprite.previous) * alpha,
+                     sprite.textureRect, sprite.color, sprite.layer);
+    queue.flush(target);
+    for (const SnapshotText &label : texts) {
+        const sf::Font *font = resources.getFont(label.font);
+        if (font == nullptr) continue;
+        sf::Text text(*font, label.string, label.size);
+        text.setPosition(label.position);
+        text.setFillColor(label.color);
+        target.draw(text);
+    }
+}
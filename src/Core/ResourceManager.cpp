@@ -1,74 +1,372 @@
 #include "Core/ResourceManager.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include "Base/Constants.hpp"
+#include "Core/AtlasManifest.hpp"
 #include "Utility/logger.hpp"
-void ResourceManager::freeSound() {
-	for (auto it = playingSounds.begin(); it != playingSounds.end(); ) {
-        if (it->get()->getStatus() == sf::Sound::Status::Stopped) {
-            auto place = it;
-            it++;
-            playingSounds.erase(place);
-        } 
-        else
-            it++;
-    }
-}
+#include "Utility/Profiler.hpp"
+
+ResourceManager::ResourceManager()
+    : soundPool{{GameConstants::MAX_VOICES, VoiceStealPolicy::Oldest}},
+      musicPlayer{pack, {GameConstants::MUSIC_MEMORY_CAP_BYTES, sf::milliseconds(GameConstants::MUSIC_CROSSFADE_MS)}},
+      decodeQueue{std::make_unique<DecodeQueue>()} {}
 
-void ResourceManager::loadSound(const std::string &path, const std::string &ID) {
-    if (textures.find(ID) != textures.end()) {
+SoundHandle ResourceManager::loadSound(const std::string &path, const std::string &ID) {
+    if (isKnownID(AssetKind::Sound, ID)) {
         Logger::error("Sound ID collision while importing: " + ID);
-        return;
+        return {};
+    }
+    auto sound = std::make_unique<sf::SoundBuffer>();
+    std::span<const std::byte> packed = findPacked(path);
+    if (packed.data() != nullptr ? !sound->loadFromMemory(packed.data(), packed.size())
+                                 : !sound->loadFromFile(getDiskPath(path))) {
+        Logger::error("Failed to load sound: " + path);
+        return {};
     }
-    soundBuffers[ID] = std::make_unique<sf::SoundBuffer>(path);
+    return soundBuffers.add(ID, std::move(sound));
 }
 
-void ResourceManager::loadFont(const std::string &path, const std::string &ID) {
-    if (fonts.find(ID) != fonts.end()) {
+FontHandle ResourceManager::loadFont(const std::string &path, const std::string &ID) {
+    if (isKnownID(AssetKind::Font, ID)) {
         Logger::error("Font ID collision while importing: " + ID);
-        return;
+        return {};
     }
-
-    fonts.at(ID) = std::make_unique<sf::Font>(path);
+    auto font = std::make_unique<sf::Font>();
+    std::span<const std::byte> packed = findPacked(path);
+    if (packed.data() != nullptr ? !font->openFromMemory(packed.data(), packed.size())
+                                 : !font->openFromFile(getDiskPath(path))) {
+        Logger::error("Failed to load font: " + path);
+        return {};
+    }
+    auto lock = lockDrawn();
+    return fonts.add(ID, std::move(font));
 }
 
-void ResourceManager::loadTexture(const std::string &path, const std::string &ID) {
-    if (textures.find(ID) != textures.end()) {
+TextureHandle ResourceManager::loadTexture(const std::string &path, const std::string &ID) {
+    if (isKnownID(AssetKind::Texture, ID)) {
         Logger::error("Texture ID collision while importing: " + ID);
+        return {};
+    }
+    auto texture = std::make_unique<sf::Texture>();
+    std::span<const std::byte> packed = findPacked(path);
+    if (packed.data() != nullptr ? !texture->loadFromMemory(packed.data(), packed.size())
+                                 : !texture->loadFromFile(getDiskPath(path))) {
+        Logger::error("Failed to load texture: " + path);
+        return {};
+    }
+    auto lock = lockDrawn();
+    return textures.add(ID, std::move(texture));
+}
+
+std::size_t ResourceManager::loadAtlas(const std::string &manifestPath) {
+    PROFILE_SCOPE("ResourceManager::loadAtlas");
+    AtlasManifest manifest;
+    std::span<const std::byte> packed = findPacked(manifestPath);
+    bool read;
+    if (packed.data() != nullptr) {
+        std::istringstream stream(std::string(reinterpret_cast<const char *>(packed.data()), packed.size()));
+        read = manifest.read(stream);
+    } else {
+        std::ifstream file(getDiskPath(manifestPath), std::ios::binary);
+        read = file && manifest.read(file);
+    }
+    if (!read) {
+        Logger::error("Failed to read atlas manifest: " + manifestPath);
+        return 0;
+    }
+
+    const std::filesystem::path directory = std::filesystem::path(manifestPath).parent_path();
+    std::vector<TextureHandle> pages;
+    std::vector<TextureHandle> loadedPages;
+    for (const std::string &page : manifest.pages) {
+        const std::string pagePath = (directory / page).generic_string();
+        TextureHandle texture = textures.find(std::string_view(pagePath));
+        if (!texture.isValid()) {
+            texture = loadTexture(pagePath, pagePath);
+            if (!texture.isValid()) {
+                auto lock = lockDrawn();
+                for (TextureHandle loaded : loadedPages) textures.remove(loaded);
+                return 0;
+            }
+            loadedPages.push_back(texture);
+        }
+        pages.push_back(texture);
+    }
+
+    std::size_t registered = 0;
+    for (const AtlasManifest::Sprite &sprite : manifest.sprites) {
+        auto frame = std::make_unique<SpriteFrame>(SpriteFrame{pages[sprite.page], sprite.rect});
+        if (!sprites.add(sprite.name, std::move(frame)).isValid()) {
+            Logger::error("Sprite ID collision while importing: " + sprite.name);
+            continue;
+        }
+        registered++;
+    }
+    return registered;
+}
+
+bool ResourceManager::mountPack(const std::string &path) {
+    PROFILE_SCOPE("ResourceManager::mountPack");
+    if (pack.isOpen()) {
+        Logger::error("An asset pack is already mounted, ignoring: " + path);
+        return false;
+    }
+    if (!pack.open(path)) {
+        Logger::error("Failed to mount asset pack: " + path);
+        return false;
+    }
+    return true;
+}
+
+void ResourceManager::setAssetRoot(const std::filesystem::path &root) {
+    assetRoot = root;
+    musicPlayer.setAssetRoot(root);
+}
+
+std::span<const std::byte> ResourceManager::findPacked(const std::string &path) const {
+    return pack.findPath(path);
+}
+
+bool ResourceManager::isKnownID(AssetKind kind, const std::string &ID) const {
+    if (pendingLoads.count({kind, ID}) != 0) return true;
+    // Compare hashes, not names: a colliding name could never be added.
+    StringId id = StringId::hash(ID);
+    switch (kind) {
+        case AssetKind::Texture:
+            return textures.find(id).isValid();
+        case AssetKind::Sound:
+            return soundBuffers.find(id).isValid();
+        case AssetKind::Font:
+            return fonts.find(id).isValid();
+    }
+    return false;
+}
+
+std::future<bool> ResourceManager::queueLoad(AssetKind kind, const std::string &path,
+                                             const std::string &ID) {
+    auto asset = std::make_shared<DecodedAsset>();
+    asset->kind = kind;
+    asset->ID = ID;
+    asset->path = path;
+    asset->packed = findPacked(path);
+    asset->file = getDiskPath(path);
+    std::error_code error;
+    asset->sourceBytes = asset->packed.data() != nullptr
+                             ? asset->packed.size()
+                             : static_cast<std::size_t>(std::filesystem::file_size(asset->file, error));
+    if (error) asset->sourceBytes = 0;
+    std::future<bool> result = asset->promise.get_future();
+    if (isKnownID(kind, ID)) {
+        Logger::error("Asset ID collision while importing: " + ID);
+        asset->promise.set_value(false);
+        return result;
+    }
+
+    if (progress.isDone()) progress = {};
+    progress.requested++;
+    pendingLoads.emplace(std::make_pair(kind, ID), asset);
+    if (!loaderPool) loaderPool = std::make_unique<ThreadPool>();
+
+    // The worker only touches the asset it owns and the queue; the queue is
+    // destroyed after the pool has joined its workers.
+    DecodeQueue *queue = decodeQueue.get();
+    loaderPool->submit([queue, asset]() {
+        PROFILE_SCOPE("ResourceManager::decode");
+        switch (asset->kind) {
+            case AssetKind::Texture:
+                asset->image = std::make_unique<sf::Image>();
+                if (asset->packed.data() != nullptr
+                        ? !asset->image->loadFromMemory(asset->packed.data(), asset->packed.size())
+                        : !asset->image->loadFromFile(asset->file))
+                    asset->image.reset();
+                break;
+            case AssetKind::Sound:
+                asset->sound = std::make_unique<sf::SoundBuffer>();
+                if (asset->packed.data() != nullptr
+                        ? !asset->sound->loadFromMemory(asset->packed.data(), asset->packed.size())
+                        : !asset->sound->loadFromFile(asset->file))
+                    asset->sound.reset();
+                break;
+            case AssetKind::Font:
+                asset->font = std::make_unique<sf::Font>();
+                if (asset->packed.data() != nullptr
+                        ? !asset->font->openFromMemory(asset->packed.data(), asset->packed.size())
+                        : !asset->font->openFromFile(asset->file))
+                    asset->font.reset();
+                break;
+        }
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->ready.push_back(asset);
+    });
+    return result;
+}
+
+std::future<bool> ResourceManager::loadSoundAsync(const std::string &path, const std::string &ID) {
+    return queueLoad(AssetKind::Sound, path, ID);
+}
+
+std::future<bool> ResourceManager::loadTextureAsync(const std::string &path,
+                                                    const std::string &ID) {
+    return queueLoad(AssetKind::Texture, path, ID);
+}
+
+std::future<bool> ResourceManager::loadFontAsync(const std::string &path, const std::string &ID) {
+    return queueLoad(AssetKind::Font, path, ID);
+}
+
+bool ResourceManager::cancelLoad(AssetKind kind, const std::string &ID) {
+    auto found = pendingLoads.find({kind, ID});
+    if (found == pendingLoads.end()) return false;
+    found->second->cancelled = true;
+    pendingLoads.erase(found);
+    return true;
+}
+
+std::size_t ResourceManager::getPendingMemoryUsage(AssetKind kind, const std::string &ID) const {
+    auto found = pendingLoads.find({kind, ID});
+    return found == pendingLoads.end() ? 0 : found->second->sourceBytes;
+}
+
+void ResourceManager::finishLoad(DecodedAsset &asset) {
+    if (asset.cancelled) {
+        // Its ID may already belong to a newer load, which stays pending
+        progress.finished++;
+        asset.promise.set_value(false);
         return;
     }
+    pendingLoads.erase({asset.kind, asset.ID});
+    bool loaded = false;
+    switch (asset.kind) {
+        case AssetKind::Texture:
+            if (asset.image) {
+                auto texture = std::make_unique<sf::Texture>();
+                loaded = texture->loadFromImage(*asset.image);
+                if (loaded) {
+                    auto lock = lockDrawn();
+                    textures.add(asset.ID, std::move(texture));
+                }
+            }
+            break;
+        case AssetKind::Sound:
+            loaded = asset.sound != nullptr;
+            if (loaded) soundBuffers.add(asset.ID, std::move(asset.sound));
+            break;
+        case AssetKind::Font:
+            loaded = asset.font != nullptr;
+            if (loaded) {
+                auto lock = lockDrawn();
+                fonts.add(asset.ID, std::move(asset.font));
+            }
+            break;
+    }
+    if (!loaded) {
+        Logger::error("Failed to load asset: " + asset.path);
+        progress.failed++;
+    }
+    progress.finished++;
+    asset.promise.set_value(loaded);
+}
+
+std::size_t ResourceManager::finishUploads(sf::Time budget) {
+    PROFILE_SCOPE("ResourceManager::finishUploads");
+    sf::Clock clock;
+    std::size_t finished = 0;
+    do {
+        std::shared_ptr<DecodedAsset> asset;
+        {
+            std::lock_guard<std::mutex> lock(decodeQueue->mutex);
+            if (decodeQueue->ready.empty()) break;
+            asset = std::move(decodeQueue->ready.front());
+            decodeQueue->ready.pop_front();
+        }
+        finishLoad(*asset);
+        finished++;
+    } while (clock.getElapsedTime() < budget);
+    return finished;
 }
 
 
 ResourceManager::~ResourceManager() {
+    soundPool.stopAll();
     textures.clear();
     soundBuffers.clear();
     fonts.clear();
+    sprites.clear();
 }
 
-void ResourceManager::playSound(const std::string &ID) {
-    freeSound();
-    if (soundBuffers.find(ID) == soundBuffers.end()) {
+VoiceHandle ResourceManager::playSound(const std::string &ID, const SoundParams &params) {
+    SoundHandle sound = soundBuffers.find(std::string_view(ID));
+    if (!sound.isValid()) {
         Logger::error("Sound ID not found: " + ID);
-        return;
+        return {};
     }
-    std::unique_ptr<sf::Sound> sound = std::make_unique<sf::Sound>(*(soundBuffers[ID].get()));
-    sound->play();
-    playingSounds.push_back(std::move(sound));
-    // std::cerr << playingSounds.size();
+    return playSound(sound, params);
 }
 
-const sf::Texture *const ResourceManager::getTexture(const std::string &ID) const {
-    if (textures.find(ID) == textures.end()) {
-        Logger::error("Texture ID not found: " + ID);
-        return nullptr;
+VoiceHandle ResourceManager::playSound(SoundHandle sound, const SoundParams &params) {
+    const sf::SoundBuffer *buffer = soundBuffers.get(sound);
+    if (buffer == nullptr) {
+        Logger::error("Playing a stale sound handle");
+        return {};
     }
-    return textures.at(ID).get();
+    return soundPool.play(soundBuffers.getId(sound), *buffer, params);
+}
 
+const sf::Texture *const ResourceManager::getTexture(const std::string &ID) const {
+    const sf::Texture *texture = textures.get(textures.find(std::string_view(ID)));
+    if (texture == nullptr) Logger::error("Texture ID not found: " + ID);
+    return texture;
 }
+
+const SpriteFrame *ResourceManager::getSprite(const std::string &ID) const {
+    const SpriteFrame *sprite = sprites.get(sprites.find(std::string_view(ID)));
+    if (sprite == nullptr) Logger::error("Sprite ID not found: " + ID);
+    return sprite;
+}
+
 const sf::Font *const ResourceManager::getFont(const std::string &ID) const {
-    if (fonts.find(ID) == fonts.end()) {
-        Logger::error("Texture ID not found: " + ID);
-        return nullptr;
+    const sf::Font *font = fonts.get(fonts.find(std::string_view(ID)));
+    if (font == nullptr) Logger::error("Font ID not found: " + ID);
+    return font;
+}
+
+std::size_t ResourceManager::getMemoryUsage(TextureHandle texture) const {
+    const sf::Texture *loaded = textures.get(texture);
+    if (loaded == nullptr) return 0;
+    return static_cast<std::size_t>(loaded->getSize().x) * loaded->getSize().y * 4;
+}
+
+std::size_t ResourceManager::getMemoryUsage(SoundHandle sound) const {
+    const sf::SoundBuffer *loaded = soundBuffers.get(sound);
+    if (loaded == nullptr) return 0;
+    return static_cast<std::size_t>(loaded->getSampleCount()) * sizeof(std::int16_t);
+}
+
+void ResourceManager::unloadTexture(TextureHandle texture) {
+    bool removed;
+    {
+        auto lock = lockDrawn();
+        removed = textures.remove(texture);
     }
-    return fonts.at(ID).get();
+    if (!removed) Logger::error("Unloading a stale texture handle");
+}
 
+void ResourceManager::unloadSound(SoundHandle sound) {
+    StringId id = soundBuffers.getId(sound);
+    if (soundBuffers.get(sound) != nullptr) soundPool.stopAll(id);
+    if (!soundBuffers.remove(sound)) Logger::error("Unloading a stale sound handle");
+}
 
-}
\ No newline at end of file
+void ResourceManager::unloadFont(FontHandle font) {
+    bool removed;
+    {
+        auto lock = lockDrawn();
+        removed = fonts.remove(font);
+    }
+    if (!removed) Logger::error("Unloading a stale font handle");
+}
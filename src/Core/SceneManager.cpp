@@ -1,29 +1,239 @@
 #include "Core/SceneManager.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+
+#include "Base/Constants.hpp"
 #include "Utility/logger.hpp"
 
+SceneManager::~SceneManager() {
+    // Let a running preload finish before the scenes are released
+    loaderPool.reset();
+    for (auto &[name, entry] : sceneStorage)
+        if (entry.scene) entry.scene->onUnload();
+}
+
+void SceneManager::registerScene(const std::string &sceneName, SceneFactory factory) {
+    if (!factory) {
+        Logger::critical("Registering a scene without a factory");
+        return;
+    }
+    if (!sceneStorage.try_emplace(sceneName, SceneEntry{std::move(factory)}).second)
+        Logger::error("Name conflict: Inserting a duplicate scene label");
+}
+
+bool SceneManager::preload(const std::string &sceneName) {
+    auto found = sceneStorage.find(sceneName);
+    if (found == sceneStorage.end()) {
+        Logger::error("Preloading non-existent scene");
+        return false;
+    }
+    SceneEntry &entry = found->second;
+    if (entry.scene || entry.pending.valid()) return true;
+    // One worker: preloads are rare and should not compete with the game for cores
+    if (!loaderPool) loaderPool = std::make_unique<ThreadPool>(1);
+    entry.pending = loaderPool->submit(
+        [factory = entry.factory, &target = target, sceneName] { return factory(target, sceneName); });
+    return true;
+}
+
+bool SceneManager::isLoaded(const std::string &sceneName) const {
+    auto found = sceneStorage.find(sceneName);
+    return found != sceneStorage.end() && found->second.scene != nullptr;
+}
+
+void SceneManager::setMemoryBudget(std::size_t bytes) {
+    memoryBudget = bytes;
+    evictOverBudget();
+}
+
+std::size_t SceneManager::getResidentMemory() const {
+    std::size_t bytes = 0;
+    for (const auto &[name, entry] : sceneStorage)
+        if (entry.scene) bytes += entry.scene->getMemoryUsage();
+    return bytes;
+}
+
 void SceneManager::changeScene(const std::string &sceneName) {
-    if (sceneStorage.find(sceneName) == sceneStorage.end()) {
+    auto found = sceneStorage.find(sceneName);
+    if (found == sceneStorage.end()) {
         Logger::error("Switching to non-existent scene");
         return;
     }
-    currentScene = sceneStorage[sceneName].get();
+    Scene *next = build(sceneName, found->second);
+    if (next == nullptr || (stack.size() == 1 && next == currentScene)) return;
+    bool stays = false;
+    for (auto layer = stack.rbegin(); layer != stack.rend(); ++layer) {
+        if (layer->scene == next) {
+            stays = true;
+            continue;
+        }
+        layer->scene->onExit();
+        touch(layer->scene);
+    }
+    stack.clear();
+    currentScene = nullptr;
+    if (stays) {
+        stack.push_back({next});
+        currentScene = next;
+    } else {
+        enter(next, found->second);
+    }
+    evictOverBudget();
+}
+
+void SceneManager::pushScene(const std::string &sceneName) {
+    auto found = sceneStorage.find(sceneName);
+    if (found == sceneStorage.end()) {
+        Logger::error("Pushing non-existent scene");
+        return;
+    }
+    Scene *next = build(sceneName, found->second);
+    if (next == nullptr) return;
+    for (const Layer &layer : stack) {
+        if (layer.scene == next) {
+            Logger::error("Pushing a scene that is already on the stack");
+            return;
+        }
+    }
+    enter(next, found->second);
+    evictOverBudget();
 }
 
-void SceneManager::render() {
+void SceneManager::popScene() {
+    if (stack.empty()) {
+        Logger::error("Popping an empty scene stack");
+        return;
+    }
+    currentScene->onExit();
+    touch(currentScene);
+    stack.pop_back();
+    currentScene = stack.empty() ? nullptr : stack.back().scene;
+    if (musicPlayer != nullptr && currentScene != nullptr && !currentScene->getMusicTrack().empty())
+        musicPlayer->play(currentScene->getMusicTrack());
+    evictOverBudget();
+}
+
+void SceneManager::enter(Scene *scene, SceneEntry &entry) {
+    stack.push_back({scene});
+    currentScene = scene;
+    entry.lastUsed = ++useClock;
+    currentScene->onEnter();
+    if (musicPlayer != nullptr && !currentScene->getMusicTrack().empty())
+        musicPlayer->play(currentScene->getMusicTrack());
+}
+
+void SceneManager::touch(const Scene *scene) {
+    for (auto &[name, entry] : sceneStorage)
+        if (entry.scene.get() == scene) entry.lastUsed = ++useClock;
+}
+
+void SceneManager::setContext(const SceneContext &context) {
+    this->context = context;
+    for (auto &[name, entry] : sceneStorage)
+        if (entry.scene) entry.scene->setContext(context);
+}
+
+Scene *SceneManager::build(const std::string &sceneName, SceneEntry &entry) {
+    if (entry.scene) return entry.scene.get();
+    try {
+        if (entry.pending.valid())
+            finishBuild(entry, entry.pending.get());
+        else
+            finishBuild(entry, entry.factory(target, sceneName));
+    } catch (const std::exception &exception) {
+        Logger::critical("Building scene " + sceneName + " failed: " + exception.what());
+    }
+    return entry.scene.get();
+}
+
+void SceneManager::finishBuild(SceneEntry &entry, std::unique_ptr<Scene> scene) {
+    entry.scene = std::move(scene);
+    if (!entry.scene) return;
+    entry.lastUsed = ++useClock;
+    entry.scene->setContext(context);
+    entry.scene->onLoad();
+}
+
+void SceneManager::finishPreloads() {
+    bool finished = false;
+    for (auto &[name, entry] : sceneStorage) {
+        if (!entry.pending.valid() ||
+            entry.pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            continue;
+        build(name, entry);
+        finished = true;
+    }
+    if (finished) evictOverBudget();
+}
+
+void SceneManager::evictOverBudget() {
+    std::size_t resident = getResidentMemory();
+    while (resident > memoryBudget) {
+        SceneEntry *oldest = nullptr;
+        for (auto &[name, entry] : sceneStorage) {
+            if (!entry.scene || (oldest != nullptr && entry.lastUsed >= oldest->lastUsed)) continue;
+            const bool onStack = std::any_of(stack.begin(), stack.end(),
+                                             [&](const Layer &layer) { return layer.scene == entry.scene.get(); });
+            if (!onStack) oldest = &entry;
+        }
+        if (oldest == nullptr) return;
+        const std::size_t bytes = oldest->scene->getMemoryUsage();
+        Logger::logf(LogLevel::INFO, "Evicting scene {} ({} bytes)", oldest->scene->getName(), bytes);
+        oldest->scene->onUnload();
+        oldest->scene.reset();
+        resident -= std::min(resident, bytes);
+        evictions++;
+    }
+}
+
+void SceneManager::render(float alpha) {
     try {
         checkNullptr();
-        window.draw(*currentScene);
+        const std::size_t firstActive = firstActiveLayer();
+        for (std::size_t index = firstVisibleLayer(); index < stack.size(); index++) {
+            Layer &layer = stack[index];
+            if (index < firstActive && drawCached(layer)) continue;
+            layer.cacheValid = false;
+            // Paused scenes did not tick, so they show the state of their last one
+            layer.scene->setInterpolation(index < firstActive ? 1.f : alpha);
+            target.draw(*layer.scene);
+        }
     }
     catch(GameException exception) {
         Logger::critical("Drawing a non-existent scene");
     }
 }
 
+void SceneManager::snapshot(RenderSnapshot &snapshot) {
+    try {
+        checkNullptr();
+        const std::size_t firstActive = firstActiveLayer();
+        for (std::size_t index = firstVisibleLayer(); index < stack.size(); index++) {
+            const std::size_t firstSprite = snapshot.sprites.size();
+            stack[index].scene->snapshot(snapshot);
+            if (index >= firstActive) continue;
+            // Drop the motion of a paused scene's last tick, or interpolation would replay it every tick
+            for (std::size_t sprite = firstSprite; sprite < snapshot.sprites.size(); sprite++)
+                snapshot.sprites[sprite].previous = snapshot.sprites[sprite].current;
+        }
+    }
+    catch(GameException exception) {
+        Logger::critical("Snapshotting a non-existent scene");
+    }
+}
+
 void SceneManager::update() {
     try {
-        
+        finishPreloads();
         checkNullptr();
-        currentScene->update();
+        for (std::size_t index = firstActiveLayer(); index < stack.size(); index++) {
+            Scene *scene = stack[index].scene;
+            for (int subtick = 0; subtick < GameConstants::SUBTICKS_PER_TICK; subtick++)
+                scene->subtick();
+            scene->update();
+        }
     }
     catch(GameException exception) {
         Logger::critical("Updating a non-existent scene");
@@ -52,4 +262,48 @@ void SceneManager::handleInput() {
 
 void SceneManager::checkNullptr() {
     if (currentScene == nullptr) throw GameException("Error: nullptr access");
+}
+
+std::size_t SceneManager::firstVisibleLayer() const {
+    for (std::size_t index = stack.size(); index-- > 0;)
+        if (stack[index].scene->isOpaque()) return index;
+    return 0;
+}
+
+std::size_t SceneManager::firstActiveLayer() const {
+    for (std::size_t index = stack.size(); index-- > 1;)
+        if (stack[index].scene->isPausingBelow()) return index;
+    return 0;
+}
+
+bool SceneManager::drawCached(Layer &layer) {
+    if (cacheUnavailable) return false;
+    const sf::Vector2u size = target.getSize();
+    if (!layer.cache || layer.cache->getSize() != size) {
+        layer.cacheValid = false;
+        if (!layer.cache) layer.cache = std::make_unique<sf::RenderTexture>();
+        if (!layer.cache->resize(size)) {
+            Logger::warning("Render texture unavailable, redrawing paused scenes every frame");
+            layer.cache.reset();
+            cacheUnavailable = true;
+            return false;
+        }
+    }
+    if (!layer.cacheValid) {
+        layer.cache->setView(target.getView());
+        layer.cache->clear(sf::Color::Transparent);
+        layer.scene->setInterpolation(1.f);
+        layer.cache->draw(*layer.scene);
+        layer.cache->display();
+        layer.cacheValid = true;
+    }
+    // The cache already went through the scene's view; lay it over the target pixel for pixel.
+    // Alpha blending into a transparent cache leaves its colours premultiplied, so they are
+    // added as they are: blending them by alpha again would fade translucent content twice.
+    const sf::View view = target.getView();
+    target.setView(target.getDefaultView());
+    const sf::BlendMode premultipliedAlpha(sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha);
+    target.draw(sf::Sprite(layer.cache->getTexture()), sf::RenderStates(premultipliedAlpha));
+    target.setView(view);
+    return true;
 }
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include "Core/SoundPool.hpp"
+
+#include <algorithm>
+
+SoundPool::SoundPool(const SoundPoolConfig &config)
+    : stealPolicy{config.stealPolicy}, silence{std::make_unique<sf::SoundBuffer>()} {
+    std::size_t voiceCount = std::max<std::size_t>(config.maxVoices, 1);
+    voices.resize(voiceCount);
+    freeVoices.reserve(voiceCount);
+    for (std::size_t voice = voiceCount; voice-- > 0;) {
+        voices[voice].sound.emplace(*silence);
+        freeVoices.push_back(static_cast<std::uint32_t>(voice));
+    }
+}
+
+SoundPool::~SoundPool() { stopAll(); }
+
+std::uint32_t SoundPool::internID(StringId ID) {
+    auto found = soundIDs.find(ID.value);
+    if (found != soundIDs.end()) return found->second;
+    auto index = static_cast<std::uint32_t>(idStates.size());
+    idStates.push_back({});
+    soundIDs.emplace(ID.value, index);
+    return index;
+}
+
+void SoundPool::release(std::uint32_t voice) {
+    Voice &slot = voices[voice];
+    slot.sound->stop();
+    slot.active = false;
+    slot.generation++;
+    idStates[slot.soundID].active--;
+    freeVoices.push_back(voice);
+}
+
+void SoundPool::setVoiceLimit(StringId ID, std::size_t maxConcurrent) {
+    idStates[internID(ID)].limit = std::max<std::size_t>(maxConcurrent, 1);
+}
+
+std::uint32_t SoundPool::chooseVictim(const SoundParams &params,
+                                      const std::uint32_t *soundID) const {
+    if (stealPolicy == VoiceStealPolicy::None) return VoiceHandle::INVALID;
+    std::uint32_t victim = VoiceHandle::INVALID;
+    for (std::uint32_t index = 0; index < voices.size(); index++) {
+        const Voice &voice = voices[index];
+        if (!voice.active || (soundID != nullptr && voice.soundID != *soundID)) continue;
+        if (victim == VoiceHandle::INVALID) {
+            victim = index;
+            continue;
+        }
+        const Voice &best = voices[victim];
+        bool better = voice.startOrder < best.startOrder;
+        if (stealPolicy == VoiceStealPolicy::LowestPriority && voice.priority != best.priority)
+            better = voice.priority < best.priority;
+        else if (stealPolicy == VoiceStealPolicy::Quietest && voice.volume != best.volume)
+            better = voice.volume < best.volume;
+        if (better) victim = index;
+    }
+    if (victim != VoiceHandle::INVALID && stealPolicy == VoiceStealPolicy::LowestPriority &&
+        voices[victim].priority > params.priority)
+        return VoiceHandle::INVALID;
+    return victim;
+}
+
+VoiceHandle SoundPool::play(StringId ID, const sf::SoundBuffer &buffer,
+                            const SoundParams &params) {
+    std::uint32_t soundID = internID(ID);
+    if (idStates[soundID].active >= idStates[soundID].limit) {
+        update();
+        if (idStates[soundID].active >= idStates[soundID].limit) {
+            std::uint32_t victim = chooseVictim(params, &soundID);
+            if (victim == VoiceHandle::INVALID) {
+                droppedCount++;
+                return {};
+            }
+            release(victim);
+            stolenCount++;
+        }
+    }
+    if (freeVoices.empty()) {
+        update();
+        if (freeVoices.empty()) {
+            std::uint32_t victim = chooseVictim(params, nullptr);
+            if (victim == VoiceHandle::INVALID) {
+                droppedCount++;
+                return {};
+            }
+            release(victim);
+            stolenCount++;
+        }
+    }
+
+    std::uint32_t index = freeVoices.back();
+    freeVoices.pop_back();
+    Voice &voice = voices[index];
+    voice.soundID = soundID;
+    voice.startOrder = playCounter++;
+    voice.priority = params.priority;
+    voice.volume = params.volume;
+    voice.active = true;
+    idStates[soundID].active++;
+    voice.sound->setBuffer(buffer);
+    voice.sound->setVolume(params.volume);
+    voice.sound->setPitch(params.pitch);
+    voice.sound->play();
+    return {index, voice.generation};
+}
+
+void SoundPool::stop(const VoiceHandle &handle) {
+    if (handle.voice >= voices.size()) return;
+    const Voice &voice = voices[handle.voice];
+    if (!voice.active || voice.generation != handle.generation) return;
+    release(handle.voice);
+}
+
+void SoundPool::stopAll() {
+    for (std::uint32_t index = 0; index < voices.size(); index++)
+        if (voices[index].active) release(index);
+}
+
+void SoundPool::stopAll(StringId ID) {
+    auto found = soundIDs.find(ID.value);
+    if (found == soundIDs.end()) return;
+    for (std::uint32_t index = 0; index < voices.size(); index++)
+        if (voices[index].active && voices[index].soundID == found->second) release(index);
+}
+
+bool SoundPool::isPlaying(const VoiceHandle &handle) const {
+    if (handle.voice >= voices.size()) return false;
+    const Voice &voice = voices[handle.voice];
+    return voice.active && voice.generation == handle.generation &&
+           voice.sound->getStatus() != sf::Sound::Status::Stopped;
+}
+
+void SoundPool::update() {
+    for (std::uint32_t index = 0; index < voices.size(); index++) {
+        const Voice &voice = voices[index];
+        if (voice.active && voice.sound->getStatus() == sf::Sound::Status::Stopped) release(index);
+    }
+}
@@ -0,0 +1,282 @@
+#include "Map/FlowField.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+
+#include "Utility/Profiler.hpp"
+
+namespace {
+constexpr std::uint32_t UNREACHABLE = FlowFieldSnapshot::UNREACHABLE;
+constexpr std::uint8_t NO_DIRECTION = FlowFieldSnapshot::NO_DIRECTION;
+constexpr int OFFSET_X[8] = {1, 1, 0, -1, -1, -1, 0, 1};
+constexpr int OFFSET_Y[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+constexpr std::uint32_t STRAIGHT_STEP = 10; ///< Cost of an orthogonal step over a cost-1 tile.
+constexpr std::uint32_t DIAGONAL_STEP = 14; ///< About STRAIGHT_STEP * sqrt(2).
+constexpr float DIAGONAL = 0.70710678f;
+
+sf::Vector2i offset(int step) { return {OFFSET_X[step], OFFSET_Y[step]}; }
+bool isDiagonal(int step) { return (step & 1) != 0; }
+}  // namespace
+
+const std::array<sf::Vector2f, 9> FlowFieldSnapshot::DIRECTIONS = {
+    sf::Vector2f{1.f, 0.f},       sf::Vector2f{DIAGONAL, DIAGONAL},   sf::Vector2f{0.f, 1.f},
+    sf::Vector2f{-DIAGONAL, DIAGONAL}, sf::Vector2f{-1.f, 0.f},      sf::Vector2f{-DIAGONAL, -DIAGONAL},
+    sf::Vector2f{0.f, -1.f},      sf::Vector2f{DIAGONAL, -DIAGONAL},  sf::Vector2f{0.f, 0.f}};
+
+sf::Vector2f FlowFieldSnapshot::getDirectionAt(sf::Vector2f position) const {
+    return getDirection({static_cast<int>(std::floor(position.x / cellSize)),
+                         static_cast<int>(std::floor(position.y / cellSize))});
+}
+
+FlowField::FlowField(const MapGrid &grid, const std::vector<sf::Vector2i> &goals, bool threaded)
+    : grid(grid) {
+    const std::size_t cells = grid.getCosts().size();
+    isGoal.assign(cells, 0);
+    for (sf::Vector2i goal : goals)
+        if (grid.contains(goal)) isGoal[grid.index(goal)] = 1;
+    distance.assign(cells, UNREACHABLE);
+    direction.assign(cells, NO_DIRECTION);
+    mark.assign(cells, 0);
+    computeAll();
+    publish();
+    if (threaded) worker = std::thread(&FlowField::workerLoop, this);
+}
+
+FlowField::~FlowField() {
+    if (!worker.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(editMutex);
+        stopping = true;
+    }
+    editsQueued.notify_one();
+    worker.join();
+}
+
+void FlowField::setCost(sf::Vector2i cell, std::uint8_t cost) {
+    if (!worker.joinable()) {
+        applyEdit({cell, cost});
+        publish();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(editMutex);
+        pendingEdits.push_back({cell, cost});
+    }
+    editsQueued.notify_one();
+}
+
+std::shared_ptr<const FlowFieldSnapshot> FlowField::getSnapshot() const {
+    std::lock_guard<std::mutex> lock(publishedMutex);
+    return published;
+}
+
+void FlowField::waitForUpdates() {
+    if (!worker.joinable()) return;
+    std::unique_lock<std::mutex> lock(editMutex);
+    editsDone.wait(lock, [this]() { return pendingEdits.empty() && !busy; });
+}
+
+void FlowField::workerLoop() {
+    PROFILE_THREAD_NAME("FlowField");
+    std::unique_lock<std::mutex> lock(editMutex);
+    while (true) {
+        editsQueued.wait(lock, [this]() { return stopping || !pendingEdits.empty(); });
+        if (stopping) return;
+        appliedEdits.swap(pendingEdits);
+        busy = true;
+        lock.unlock();
+        {
+            PROFILE_SCOPE("FlowField::repair");
+            for (const Edit &edit : appliedEdits) applyEdit(edit);
+            publish();
+        }
+        appliedEdits.clear();
+        lock.lock();
+        busy = false;
+        if (pendingEdits.empty()) editsDone.notify_all();
+    }
+}
+
+std::uint32_t FlowField::stepCost(sf::Vector2i from, int step) const {
+    const sf::Vector2i to = from + offset(step);
+    if (!grid.contains(from) || !grid.contains(to) || grid.isBlocked(to)) return 0;
+    const std::uint8_t cost = grid.getCost(from);
+    if (cost == MapGrid::BLOCKED) return 0;
+    if (!isDiagonal(step)) return STRAIGHT_STEP * cost;
+    if (grid.isBlocked({to.x, from.y}) || grid.isBlocked({from.x, to.y})) return 0;
+    return DIAGONAL_STEP * cost;
+}
+
+void FlowField::computeAll() {
+    std::fill(distance.begin(), distance.end(), UNREACHABLE);
+    std::fill(direction.begin(), direction.end(), NO_DIRECTION);
+    heap.clear();
+    for (std::uint32_t cell = 0; cell < isGoal.size(); cell++) {
+        if (!isGoal[cell] || grid.isBlocked(grid.cellAt(cell))) continue;
+        distance[cell] = 0;
+        heap.push_back({0, cell});
+    }
+    std::make_heap(heap.begin(), heap.end(), std::greater<>());
+    relax();
+}
+
+void FlowField::relax() {
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<>());
+        const auto [cellDistance, cell] = heap.back();
+        heap.pop_back();
+        if (cellDistance != distance[cell]) continue;
+        const sf::Vector2i position = grid.cellAt(cell);
+        // Grow backwards: find the neighbors that can step onto this cell
+        for (int step = 0; step < 8; step++) {
+            const sf::Vector2i from = position - offset(step);
+            const std::uint32_t cost = stepCost(from, step);
+            if (cost == 0) continue;
+            const std::uint32_t neighbor = static_cast<std::uint32_t>(grid.index(from));
+            const std::uint32_t candidate = cellDistance + cost;
+            if (candidate >= distance[neighbor]) continue;
+            distance[neighbor] = candidate;
+            direction[neighbor] = static_cast<std::uint8_t>(step);
+            heap.push_back({candidate, neighbor});
+            std::push_heap(heap.begin(), heap.end(), std::greater<>());
+        }
+    }
+}
+
+void FlowField::applyEdit(const Edit &edit) {
+    if (!grid.contains(edit.cell)) return;
+    const std::uint8_t oldCost = grid.getCost(edit.cell);
+    if (oldCost == edit.cost) return;
+    grid.setCost(edit.cell, edit.cost);
+    const std::uint32_t cell = static_cast<std::uint32_t>(grid.index(edit.cell));
+    if (edit.cost > oldCost)
+        raise(cell);
+    else
+        lower(cell, oldCost == MapGrid::BLOCKED);
+}
+
+void FlowField::raise(std::uint32_t cell) {
+    if (++repair == 0) {
+        std::fill(mark.begin(), mark.end(), 0);
+        repair = 1;
+    }
+    region.clear();
+    const auto reset = [this](std::uint32_t resetCell) {
+        if (mark[resetCell] == repair) return;
+        mark[resetCell] = repair;
+        region.push_back(resetCell);
+    };
+
+    // Routes through the tile, and diagonal routes squeezing past its corners, are suspect
+    const sf::Vector2i position = grid.cellAt(cell);
+    reset(cell);
+    for (int step = 0; step < 8; step++) {
+        const sf::Vector2i neighbor = position + offset(step);
+        if (!grid.contains(neighbor)) continue;
+        const std::uint8_t next = direction[grid.index(neighbor)];
+        if (next == NO_DIRECTION || !isDiagonal(next)) continue;
+        const sf::Vector2i target = neighbor + offset(next);
+        if (sf::Vector2i{target.x, neighbor.y} == position || sf::Vector2i{neighbor.x, target.y} == position)
+            reset(static_cast<std::uint32_t>(grid.index(neighbor)));
+    }
+    // Add every cell whose direction chain leads into the suspect cells
+    for (std::size_t index = 0; index < region.size(); index++) {
+        const sf::Vector2i current = grid.cellAt(region[index]);
+        for (int step = 0; step < 8; step++) {
+            const sf::Vector2i from = current - offset(step);
+            if (!grid.contains(from)) continue;
+            const std::uint32_t fromCell = static_cast<std::uint32_t>(grid.index(from));
+            if (direction[fromCell] == step) reset(fromCell);
+        }
+    }
+    for (std::uint32_t resetCell : region) {
+        distance[resetCell] = UNREACHABLE;
+        direction[resetCell] = NO_DIRECTION;
+    }
+
+    // Reseed the region from its untouched border, then re-solve inside it
+    heap.clear();
+    for (std::uint32_t resetCell : region) {
+        const sf::Vector2i current = grid.cellAt(resetCell);
+        if (grid.isBlocked(current)) continue;
+        if (isGoal[resetCell]) {
+            distance[resetCell] = 0;
+            heap.push_back({0, resetCell});
+            continue;
+        }
+        std::uint32_t best = UNREACHABLE;
+        std::uint8_t bestStep = NO_DIRECTION;
+        for (int step = 0; step < 8; step++) {
+            const std::uint32_t cost = stepCost(current, step);
+            if (cost == 0) continue;
+            const std::uint32_t target = static_cast<std::uint32_t>(grid.index(current + offset(step)));
+            if (mark[target] == repair || distance[target] == UNREACHABLE) continue;
+            if (distance[target] + cost < best) {
+                best = distance[target] + cost;
+                bestStep = static_cast<std::uint8_t>(step);
+            }
+        }
+        if (best == UNREACHABLE) continue;
+        distance[resetCell] = best;
+        direction[resetCell] = bestStep;
+        heap.push_back({best, resetCell});
+    }
+    std::make_heap(heap.begin(), heap.end(), std::greater<>());
+    relax();
+}
+
+void FlowField::lower(std::uint32_t cell, bool wasBlocked) {
+    heap.clear();
+    const sf::Vector2i position = grid.cellAt(cell);
+    if (isGoal[cell]) {
+        distance[cell] = 0;
+        direction[cell] = NO_DIRECTION;
+        heap.push_back({0, cell});
+    } else {
+        for (int step = 0; step < 8; step++) {
+            const std::uint32_t cost = stepCost(position, step);
+            if (cost == 0) continue;
+            const std::uint32_t target = static_cast<std::uint32_t>(grid.index(position + offset(step)));
+            if (distance[target] == UNREACHABLE) continue;
+            if (distance[target] + cost < distance[cell]) {
+                distance[cell] = distance[target] + cost;
+                direction[cell] = static_cast<std::uint8_t>(step);
+            }
+        }
+        if (distance[cell] != UNREACHABLE) heap.push_back({distance[cell], cell});
+    }
+    // An opened tile also unblocks the diagonals past its corners; let its neighbors retry them
+    if (wasBlocked) {
+        for (int step = 0; step < 8; step++) {
+            const sf::Vector2i neighbor = position + offset(step);
+            if (!grid.contains(neighbor)) continue;
+            const std::uint32_t neighborCell = static_cast<std::uint32_t>(grid.index(neighbor));
+            if (distance[neighborCell] != UNREACHABLE) heap.push_back({distance[neighborCell], neighborCell});
+        }
+    }
+    std::make_heap(heap.begin(), heap.end(), std::greater<>());
+    relax();
+}
+
+void FlowField::publish() {
+    std::shared_ptr<FlowFieldSnapshot> &buffer = buffers[nextBuffer];
+    if (!buffer || buffer.use_count() > 1) {
+        // A reader still holds this buffer; leave it to them
+        buffer = std::make_shared<FlowFieldSnapshot>();
+    } else {
+        // Pairs with the release in the last reader's reference drop
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    buffer->size = grid.getSize();
+    buffer->cellSize = grid.getCellSize();
+    buffer->version = ++version;
+    buffer->distance = distance;
+    buffer->direction = direction;
+    {
+        std::lock_guard<std::mutex> lock(publishedMutex);
+        published = buffer;
+    }
+    nextBuffer ^= 1;
+}
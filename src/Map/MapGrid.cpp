@@ -0,0 +1,7 @@
+#include "Map/MapGrid.hpp"
+
+#include <cmath>
+
+sf::Vector2i MapGrid::worldToCell(sf::Vector2f position) const {
+    return {static_cast<int>(std::floor(position.x / cellSize)), static_cast<int>(std::floor(position.y / cellSize))};
+}
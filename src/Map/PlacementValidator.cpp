@@ -0,0 +1,103 @@
+#include "Map/PlacementValidator.hpp"
+
+#include <algorithm>
+
+#include "Utility/Profiler.hpp"
+
+namespace {
+constexpr std::uint32_t NO_NODE = UINT32_MAX;
+constexpr int OFFSET_X[4] = {1, 0, -1, 0};
+constexpr int OFFSET_Y[4] = {0, 1, 0, -1};
+}  // namespace
+
+PlacementValidator::PlacementValidator(const MapGrid &grid, const std::vector<sf::Vector2i> &spawns,
+                                       const std::vector<sf::Vector2i> &goals)
+    : grid(grid) {
+    const std::size_t cells = grid.getCosts().size();
+    isSpawn.assign(cells, 0);
+    isGoal.assign(cells, 0);
+    for (sf::Vector2i spawn : spawns) {
+        if (!grid.contains(spawn)) continue;
+        isSpawn[grid.index(spawn)] = 1;
+        this->spawns.push_back(static_cast<std::uint32_t>(grid.index(spawn)));
+    }
+    for (sf::Vector2i goal : goals) {
+        if (!grid.contains(goal)) continue;
+        isGoal[grid.index(goal)] = 1;
+        this->goals.push_back(static_cast<std::uint32_t>(grid.index(goal)));
+    }
+}
+
+void PlacementValidator::setCost(sf::Vector2i cell, std::uint8_t cost) {
+    if (!grid.contains(cell)) return;
+    if (grid.isBlocked(cell) != (cost == MapGrid::BLOCKED)) dirty = true;
+    grid.setCost(cell, cost);
+}
+
+bool PlacementValidator::canPlace(sf::Vector2i cell) {
+    if (!grid.contains(cell) || grid.isBlocked(cell)) return false;
+    const std::size_t index = grid.index(cell);
+    if (isSpawn[index] || isGoal[index]) return false;
+    if (dirty) rebuild();
+    return !cutsPath[index];
+}
+
+bool PlacementValidator::isPathOpen() {
+    if (dirty) rebuild();
+    return std::all_of(spawns.begin(), spawns.end(), [this](std::uint32_t spawn) { return discovery[spawn] != 0; });
+}
+
+std::uint32_t PlacementValidator::edgeCount(std::uint32_t node) const {
+    if (node == isGoal.size()) return static_cast<std::uint32_t>(goals.size());
+    // Goals have a fifth edge back to the virtual node
+    return isGoal[node] ? 5 : 4;
+}
+
+std::uint32_t PlacementValidator::neighbor(std::uint32_t node, std::uint32_t edge) const {
+    const std::uint32_t root = static_cast<std::uint32_t>(isGoal.size());
+    if (node == root) return grid.isBlocked(grid.cellAt(goals[edge])) ? NO_NODE : goals[edge];
+    if (edge == 4) return root;
+    const sf::Vector2i cell = grid.cellAt(node) + sf::Vector2i{OFFSET_X[edge], OFFSET_Y[edge]};
+    if (grid.isBlocked(cell)) return NO_NODE;  // Also covers cells off the map
+    return static_cast<std::uint32_t>(grid.index(cell));
+}
+
+void PlacementValidator::rebuild() {
+    PROFILE_SCOPE("PlacementValidator::rebuild");
+    const std::uint32_t root = static_cast<std::uint32_t>(isGoal.size());
+    discovery.assign(root + 1, 0);
+    low.assign(root + 1, 0);
+    spawnsBelow.assign(root, 0);
+    cutsPath.assign(root, 0);
+    std::uint32_t time = 0;
+
+    // Iterative DFS, since a recursive one overflows the stack on large open maps
+    stack.clear();
+    discovery[root] = low[root] = ++time;
+    stack.push_back({root, 0});
+    while (!stack.empty()) {
+        const std::uint32_t node = stack.back().node;
+        if (stack.back().edge == edgeCount(node)) {
+            stack.pop_back();
+            if (stack.empty()) break;
+            const std::uint32_t parent = stack.back().node;
+            low[parent] = std::min(low[parent], low[node]);
+            if (parent == root) continue;
+            spawnsBelow[parent] += spawnsBelow[node];
+            // Without the parent this subtree cannot get back to the goals
+            if (low[node] >= discovery[parent] && spawnsBelow[node] > 0) cutsPath[parent] = 1;
+            continue;
+        }
+        const std::uint32_t next = neighbor(node, stack.back().edge++);
+        if (next == NO_NODE) continue;
+        if (discovery[next] == 0) {
+            discovery[next] = low[next] = ++time;
+            spawnsBelow[next] = isSpawn[next];
+            stack.push_back({next, 0});
+        } else {
+            low[node] = std::min(low[node], discovery[next]);
+        }
+    }
+    dirty = false;
+    rebuilds++;
+}
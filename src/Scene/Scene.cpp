@@ -0,0 +1,64 @@
+#include "Scene/Scene.hpp"
+
+#include "Core/ResourceManager.hpp"
+#include "Utility/logger.hpp"
+
+namespace {
+std::future<bool> failedLoad() {
+    std::promise<bool> promise;
+    promise.set_value(false);
+    return promise.get_future();
+}
+}  // namespace
+
+std::future<bool> Scene::loadTextureAsync(const std::string &path, const std::string &ID) {
+    if (context.resources == nullptr) {
+        Logger::error("Scene " + name + " has no resource manager to load " + path);
+        return failedLoad();
+    }
+    // An ID another scene or the game already holds is refused, and stays theirs to unload
+    if (!context.resources->isKnownID(ResourceManager::AssetKind::Texture, ID)) ownedTextures.push_back(ID);
+    return context.resources->loadTextureAsync(path, ID);
+}
+
+std::future<bool> Scene::loadSoundAsync(const std::string &path, const std::string &ID) {
+    if (context.resources == nullptr) {
+        Logger::error("Scene " + name + " has no resource manager to load " + path);
+        return failedLoad();
+    }
+    if (!context.resources->isKnownID(ResourceManager::AssetKind::Sound, ID)) ownedSounds.push_back(ID);
+    return context.resources->loadSoundAsync(path, ID);
+}
+
+void Scene::onUnload() {
+    if (context.resources == nullptr) return;
+    // Loads still decoding have no handle yet; cancelling them keeps them from landing ownerless
+    for (const std::string &ID : ownedTextures) {
+        TextureHandle texture = context.resources->getTextureHandle(StringId::hash(ID));
+        if (texture.isValid())
+            context.resources->unloadTexture(texture);
+        else
+            context.resources->cancelLoad(ResourceManager::AssetKind::Texture, ID);
+    }
+    for (const std::string &ID : ownedSounds) {
+        SoundHandle sound = context.resources->getSoundHandle(StringId::hash(ID));
+        if (sound.isValid())
+            context.resources->unloadSound(sound);
+        else
+            context.resources->cancelLoad(ResourceManager::AssetKind::Sound, ID);
+    }
+    ownedTextures.clear();
+    ownedSounds.clear();
+}
+
+std::size_t Scene::getMemoryUsage() const {
+    std::size_t bytes = sizeof(*this) + entities.getMemoryUsage();
+    if (context.resources == nullptr) return bytes;
+    for (const std::string &ID : ownedTextures)
+        bytes += context.resources->getMemoryUsage(context.resources->getTextureHandle(StringId::hash(ID))) +
+                 context.resources->getPendingMemoryUsage(ResourceManager::AssetKind::Texture, ID);
+    for (const std::string &ID : ownedSounds)
+        bytes += context.resources->getMemoryUsage(context.resources->getSoundHandle(StringId::hash(ID))) +
+                 context.resources->getPendingMemoryUsage(ResourceManager::AssetKind::Sound, ID);
+    return bytes;
+}
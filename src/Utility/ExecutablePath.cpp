@@ -0,0 +1,56 @@
+#include "Utility/ExecutablePath.hpp"
+
+#include <cstdint>
+#include <string>
+#include <system_error>
+
+#include "Utility/logger.hpp"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <mach-o/dyld.h>
+#endif
+
+namespace {
+/**
+ * @brief Asks the platform for the executable's path; empty if it cannot tell.
+ */
+std::filesystem::path queryExecutablePath() {
+#ifdef _WIN32
+    std::wstring buffer(MAX_PATH, L'\0');
+    for (;;) {
+        DWORD length = GetModuleFileNameW(nullptr, buffer.data(), static_cast<DWORD>(buffer.size()));
+        if (length == 0) return {};
+        if (length < buffer.size()) {
+            buffer.resize(length);
+            return buffer;
+        }
+        buffer.resize(buffer.size() * 2);
+    }
+#elif defined(__APPLE__)
+    std::uint32_t size = 0;
+    _NSGetExecutablePath(nullptr, &size);
+    std::string buffer(size, '\0');
+    if (_NSGetExecutablePath(buffer.data(), &size) != 0) return {};
+    buffer.resize(buffer.find('\0'));
+    return buffer;
+#else
+    std::error_code error;
+    return std::filesystem::read_symlink("/proc/self/exe", error);
+#endif
+}
+}  // namespace
+
+std::filesystem::path getExecutableDirectory() {
+    std::error_code error;
+    std::filesystem::path executable = std::filesystem::weakly_canonical(queryExecutablePath(), error);
+    if (executable.empty() || error) {
+        Logger::warning("Cannot locate the executable, resolving assets against the working directory");
+        return std::filesystem::current_path(error);
+    }
+    return executable.parent_path();
+}
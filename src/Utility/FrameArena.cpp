@@ -0,0 +1,36 @@
+#include "Utility/FrameArena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "Utility/logger.hpp"
+
+FrameArena::FrameArena(std::size_t capacity)
+    : block(std::make_unique<std::byte[]>(capacity)), capacity(capacity) {}
+
+void *FrameArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.get());
+    const std::uintptr_t start = (base + used + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    const std::size_t end = start - base + bytes;
+    if (end <= capacity) {
+        used = end;
+        return reinterpret_cast<void *>(start);
+    }
+    // Over-allocate so the result can be aligned beyond what new[] guarantees
+    overflow.push_back(std::make_unique<std::byte[]>(bytes + alignment));
+    overflowBytes += bytes + alignment;
+    const std::uintptr_t heap = reinterpret_cast<std::uintptr_t>(overflow.back().get());
+    return reinterpret_cast<void *>((heap + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1));
+}
+
+void FrameArena::reset() {
+    highWater = std::max(highWater, getUsed());
+    if (!overflow.empty()) {
+        if (overflowFrames++ == 0)
+            Logger::logf(LogLevel::WARNING, "Frame arena overflowed its {} bytes by {} bytes", capacity,
+                         overflowBytes);
+        overflow.clear();
+    }
+    used = 0;
+    overflowBytes = 0;
+}
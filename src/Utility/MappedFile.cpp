@@ -0,0 +1,107 @@
+#include "Utility/MappedFile.hpp"
+
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(MappedFile &&other) noexcept { *this = std::move(other); }
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this == &other) return *this;
+    close();
+    mapped = std::exchange(other.mapped, nullptr);
+    length = std::exchange(other.length, 0);
+    opened = std::exchange(other.opened, false);
+#ifdef _WIN32
+    fileHandle = std::exchange(other.fileHandle, nullptr);
+    mappingHandle = std::exchange(other.mappingHandle, nullptr);
+#endif
+    return *this;
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const std::filesystem::path &path) {
+    close();
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    opened = true;
+    if (size.QuadPart == 0) return true;
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void *view = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (view == nullptr) {
+        if (mapping != nullptr) CloseHandle(mapping);
+        close();
+        return false;
+    }
+    mappingHandle = mapping;
+    mapped = static_cast<const std::byte *>(view);
+    length = static_cast<std::size_t>(size.QuadPart);
+    return true;
+}
+
+void MappedFile::close() {
+    if (mapped != nullptr) UnmapViewOfFile(mapped);
+    if (mappingHandle != nullptr) CloseHandle(mappingHandle);
+    if (fileHandle != nullptr) CloseHandle(fileHandle);
+    mapped = nullptr;
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+    length = 0;
+    opened = false;
+}
+
+#else
+
+bool MappedFile::open(const std::filesystem::path &path) {
+    close();
+    int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0) return false;
+    struct stat status;
+    if (fstat(descriptor, &status) != 0) {
+        ::close(descriptor);
+        return false;
+    }
+    opened = true;
+    if (status.st_size == 0) {
+        ::close(descriptor);
+        return true;
+    }
+    void *view = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+    // The mapping keeps its own reference to the file
+    ::close(descriptor);
+    if (view == MAP_FAILED) {
+        opened = false;
+        return false;
+    }
+    mapped = static_cast<const std::byte *>(view);
+    length = static_cast<std::size_t>(status.st_size);
+    return true;
+}
+
+void MappedFile::close() {
+    if (mapped != nullptr) munmap(const_cast<std::byte *>(mapped), length);
+    mapped = nullptr;
+    length = 0;
+    opened = false;
+}
+
+#endif
@@ -0,0 +1,229 @@
+#include "Utility/Profiler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+
+#include "Utility/logger.hpp"
+
+namespace {
+/**
+ * @brief One ring slot. Fields are relaxed atomics so readers racing the
+ * owning thread get stale or torn values, never undefined behaviour.
+ */
+struct EventSlot {
+    std::atomic<const char *> name{nullptr};
+    std::atomic<std::int64_t> start{0};
+    std::atomic<std::int64_t> end{0};
+};
+
+/**
+ * @brief Ring buffer of one thread's completed zones.
+ *
+ * Works like a seqlock: the owner bumps begun before overwriting a slot and
+ * written after, so a reader can tell whether a slot changed while it read.
+ */
+struct ThreadBuffer {
+    std::unique_ptr<EventSlot[]> events = std::make_unique<EventSlot[]>(Profiler::EVENTS_PER_THREAD);
+    std::atomic<std::uint64_t> begun{0};    ///< Events whose write has started.
+    std::atomic<std::uint64_t> written{0};  ///< Total events ever recorded.
+    std::uint64_t summarized = 0;           ///< Events already folded into the statistics.
+    std::uint32_t threadId = 0;
+    std::string threadName;
+};
+
+/**
+ * @brief Gets the oldest event worth reading: one more than the ring holds is
+ * skipped, as the owner may be writing that slot already.
+ */
+std::uint64_t firstReadable(std::uint64_t written) {
+    return written >= Profiler::EVENTS_PER_THREAD ? written - Profiler::EVENTS_PER_THREAD + 1 : 0;
+}
+
+/**
+ * @brief Copies an event out of a ring that its owner may be writing.
+ * @return False if the slot was overwritten during the read; event is then garbage.
+ */
+bool readEvent(const ThreadBuffer &buffer, std::uint64_t index, ProfileEvent &event) {
+    const EventSlot &slot = buffer.events[index % Profiler::EVENTS_PER_THREAD];
+    event.name = slot.name.load(std::memory_order_relaxed);
+    event.start = slot.start.load(std::memory_order_relaxed);
+    event.end = slot.end.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    // Event index + EVENTS_PER_THREAD reuses the slot; it must not have started
+    return buffer.begun.load(std::memory_order_relaxed) <= index + Profiler::EVENTS_PER_THREAD;
+}
+
+/**
+ * @brief Per-frame totals of one zone name over the rolling window.
+ */
+struct PhaseHistory {
+    const char *name = nullptr;
+    std::array<std::int64_t, Profiler::SUMMARY_WINDOW> frameTotals{};
+    std::size_t count = 0;       ///< Valid entries in frameTotals.
+    std::size_t next = 0;        ///< Slot the next frame writes.
+    std::int64_t currentFrame = 0;
+    bool ranThisFrame = false;
+};
+
+std::mutex registryMutex;
+std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers;  // Kept after threads exit for export.
+std::vector<PhaseHistory> phaseHistories;                  // Only touched by the endFrame thread.
+std::size_t framesSinceSummary = 0;
+thread_local ThreadBuffer *currentBuffer = nullptr;
+
+ThreadBuffer &getThreadBuffer() {
+    if (currentBuffer == nullptr) {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        threadBuffers.push_back(std::make_unique<ThreadBuffer>());
+        currentBuffer = threadBuffers.back().get();
+        currentBuffer->threadId = static_cast<std::uint32_t>(threadBuffers.size());
+    }
+    return *currentBuffer;
+}
+
+PhaseHistory &getHistory(const char *name) {
+    // By content: the same literal may have a different address in each translation unit.
+    for (PhaseHistory &history : phaseHistories)
+        if (std::strcmp(history.name, name) == 0) return history;
+    phaseHistories.emplace_back();
+    phaseHistories.back().name = name;
+    return phaseHistories.back();
+}
+
+double percentile(std::vector<std::int64_t> &values, double fraction) {
+    std::size_t index = static_cast<std::size_t>(fraction * (values.size() - 1) + 0.5);
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index] / 1e6;
+}
+
+void writeEscaped(std::ofstream &file, const char *text) {
+    for (; *text != '\0'; text++) {
+        if (*text == '"' || *text == '\\') file << '\\';
+        file << *text;
+    }
+}
+}  // namespace
+
+void Profiler::record(const char *name, std::int64_t start, std::int64_t end) {
+    ThreadBuffer &buffer = getThreadBuffer();
+    std::uint64_t index = buffer.written.load(std::memory_order_relaxed);
+    buffer.begun.store(index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    EventSlot &slot = buffer.events[index % EVENTS_PER_THREAD];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.start.store(start, std::memory_order_relaxed);
+    slot.end.store(end, std::memory_order_relaxed);
+    buffer.written.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::setThreadName(const char *name) {
+    ThreadBuffer &buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(registryMutex);
+    buffer.threadName = name;
+}
+
+void Profiler::endFrame() {
+    // Zones other threads finished since the last call count towards this
+    // frame. record() never takes the lock, so this only delays new threads.
+    std::unique_lock<std::mutex> lock(registryMutex);
+    for (const auto &buffer : threadBuffers) {
+        std::uint64_t written = buffer->written.load(std::memory_order_acquire);
+        // Events overwritten before being summarized are lost for statistics.
+        buffer->summarized = std::max(buffer->summarized, firstReadable(written));
+        ProfileEvent event;
+        for (; buffer->summarized < written; buffer->summarized++) {
+            if (!readEvent(*buffer, buffer->summarized, event)) continue;
+            PhaseHistory &history = getHistory(event.name);
+            history.currentFrame += event.end - event.start;
+            history.ranThisFrame = true;
+        }
+    }
+    lock.unlock();
+    for (PhaseHistory &history : phaseHistories) {
+        if (!history.ranThisFrame) continue;
+        history.frameTotals[history.next] = history.currentFrame;
+        history.next = (history.next + 1) % SUMMARY_WINDOW;
+        history.count = std::min(history.count + 1, SUMMARY_WINDOW);
+        history.currentFrame = 0;
+        history.ranThisFrame = false;
+    }
+    if (++framesSinceSummary >= SUMMARY_LOG_INTERVAL) {
+        framesSinceSummary = 0;
+        logSummary();
+    }
+}
+
+std::vector<PhaseSummary> Profiler::getSummary() {
+    std::vector<PhaseSummary> summaries;
+    std::vector<std::int64_t> values;
+    for (const PhaseHistory &history : phaseHistories) {
+        if (history.count == 0) continue;
+        values.assign(history.frameTotals.begin(),
+                      history.frameTotals.begin() + history.count);
+        double maxMs = *std::max_element(values.begin(), values.end()) / 1e6;
+        double p50Ms = percentile(values, 0.50);
+        double p99Ms = percentile(values, 0.99);
+        summaries.push_back({history.name, p50Ms, p99Ms, maxMs, history.count});
+    }
+    return summaries;
+}
+
+void Profiler::logSummary() {
+    for (const PhaseSummary &summary : getSummary())
+        Logger::logf(LogLevel::PERFORMANCE, "{}: p50 {} ms, p99 {} ms, max {} ms ({} frames)",
+                     summary.name, summary.p50Ms, summary.p99Ms, summary.maxMs,
+                     summary.samples);
+}
+
+bool Profiler::exportChromeTrace(const std::string &path) {
+    std::ofstream file(path);
+    if (!file) {
+        Logger::error("Cannot write profiler trace: " + path);
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(registryMutex);
+    std::int64_t origin = INT64_MAX;
+    for (const auto &buffer : threadBuffers) {
+        std::uint64_t written = buffer->written.load(std::memory_order_acquire);
+        ProfileEvent event;
+        for (std::uint64_t index = firstReadable(written); index < written; index++)
+            if (readEvent(*buffer, index, event)) origin = std::min(origin, event.start);
+    }
+    bool firstEntry = true;
+    auto separator = [&]() {
+        if (!firstEntry) file << ",\n";
+        firstEntry = false;
+    };
+    file << std::fixed << std::setprecision(3);
+    file << "{\"traceEvents\":[\n";
+    for (const auto &buffer : threadBuffers) {
+        if (!buffer->threadName.empty()) {
+            separator();
+            file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                 << buffer->threadId << ",\"args\":{\"name\":\"";
+            writeEscaped(file, buffer->threadName.c_str());
+            file << "\"}}";
+        }
+        std::uint64_t written = buffer->written.load(std::memory_order_acquire);
+        ProfileEvent event;
+        for (std::uint64_t index = firstReadable(written); index < written; index++) {
+            // Skips events overwritten while being read
+            if (!readEvent(*buffer, index, event)) continue;
+            separator();
+            file << "{\"name\":\"";
+            writeEscaped(file, event.name);
+            file << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId
+                 << ",\"ts\":" << (event.start - origin) / 1000.0
+                 << ",\"dur\":" << (event.end - event.start) / 1000.0 << "}";
+        }
+    }
+    file << "\n]}\n";
+    Logger::success("Profiler trace written to " + path);
+    return static_cast<bool>(file);
+}
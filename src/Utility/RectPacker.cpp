@@ -0,0 +1,102 @@
+#include "Utility/RectPacker.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+bool overlaps(const sf::IntRect &a, const sf::IntRect &b) {
+    return a.position.x < b.position.x + b.size.x && b.position.x < a.position.x + a.size.x &&
+           a.position.y < b.position.y + b.size.y && b.position.y < a.position.y + a.size.y;
+}
+
+bool containsRect(const sf::IntRect &outer, const sf::IntRect &inner) {
+    return inner.position.x >= outer.position.x && inner.position.y >= outer.position.y &&
+           inner.position.x + inner.size.x <= outer.position.x + outer.size.x &&
+           inner.position.y + inner.size.y <= outer.position.y + outer.size.y;
+}
+}  // namespace
+
+RectPacker::RectPacker(sf::Vector2i binSize, int padding) : binSize(binSize), padding(std::max(padding, 0)) {
+    clear();
+}
+
+void RectPacker::clear() {
+    freeRects.clear();
+    // The bin gets a virtual padding strip so rectangles may touch its far edges
+    freeRects.push_back({{0, 0}, {binSize.x + padding, binSize.y + padding}});
+    usedArea = 0;
+}
+
+std::optional<sf::IntRect> RectPacker::insert(sf::Vector2i size) {
+    if (size.x <= 0 || size.y <= 0) return std::nullopt;
+    const sf::Vector2i padded{size.x + padding, size.y + padding};
+
+    const sf::IntRect *best = nullptr;
+    int bestShortSide = std::numeric_limits<int>::max();
+    int bestLongSide = std::numeric_limits<int>::max();
+    for (const sf::IntRect &free : freeRects) {
+        if (free.size.x < padded.x || free.size.y < padded.y) continue;
+        const int leftoverX = free.size.x - padded.x;
+        const int leftoverY = free.size.y - padded.y;
+        const int shortSide = std::min(leftoverX, leftoverY);
+        const int longSide = std::max(leftoverX, leftoverY);
+        if (shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide)) {
+            best = &free;
+            bestShortSide = shortSide;
+            bestLongSide = longSide;
+        }
+    }
+    if (best == nullptr) return std::nullopt;
+
+    const sf::IntRect placed{best->position, padded};
+    splitFreeRects(placed);
+    pruneFreeRects();
+    usedArea += static_cast<std::int64_t>(size.x) * size.y;
+    return sf::IntRect{placed.position, size};
+}
+
+void RectPacker::splitFreeRects(const sf::IntRect &placed) {
+    const int placedRight = placed.position.x + placed.size.x;
+    const int placedBottom = placed.position.y + placed.size.y;
+    const std::size_t count = freeRects.size();
+    for (std::size_t i = 0; i < count; i++) {
+        const sf::IntRect free = freeRects[i];
+        if (!overlaps(free, placed)) continue;
+        const int freeRight = free.position.x + free.size.x;
+        const int freeBottom = free.position.y + free.size.y;
+        // Up to four maximal pieces survive: left, right, above and below the placed rectangle
+        if (placed.position.x > free.position.x)
+            freeRects.push_back({free.position, {placed.position.x - free.position.x, free.size.y}});
+        if (placedRight < freeRight)
+            freeRects.push_back({{placedRight, free.position.y}, {freeRight - placedRight, free.size.y}});
+        if (placed.position.y > free.position.y)
+            freeRects.push_back({free.position, {free.size.x, placed.position.y - free.position.y}});
+        if (placedBottom < freeBottom)
+            freeRects.push_back({{free.position.x, placedBottom}, {free.size.x, freeBottom - placedBottom}});
+        freeRects[i].size = {0, 0};
+    }
+    std::erase_if(freeRects, [](const sf::IntRect &rect) { return rect.size.x == 0 || rect.size.y == 0; });
+}
+
+void RectPacker::pruneFreeRects() {
+    for (std::size_t i = 0; i < freeRects.size(); i++) {
+        for (std::size_t j = i + 1; j < freeRects.size();) {
+            if (containsRect(freeRects[i], freeRects[j])) {
+                freeRects[j] = freeRects.back();
+                freeRects.pop_back();
+            } else if (containsRect(freeRects[j], freeRects[i])) {
+                freeRects[i] = freeRects[j];
+                freeRects[j] = freeRects.back();
+                freeRects.pop_back();
+                j = i + 1;
+            } else {
+                j++;
+            }
+        }
+    }
+}
+
+float RectPacker::getOccupancy() const {
+    const std::int64_t binArea = static_cast<std::int64_t>(binSize.x) * binSize.y;
+    return binArea > 0 ? static_cast<float>(usedArea) / static_cast<float>(binArea) : 0.f;
+}
@@ -1,224 +1,155 @@
 #include "Utility/SignalMap.hpp"
 
+#include <array>
+#include <cstddef>
+#include <iterator>
+
 #include "Core/MouseState.hpp"
 #include "Core/KeyboardState.hpp"
 
-Mouse SignalMap::mapSfmlMouseButton(sf::Mouse::Button button) {
-    switch (button) {
-        case sf::Mouse::Button::Left:
-            return Mouse::Left;
-        case sf::Mouse::Button::Right:
-            return Mouse::Right;
-        default:
-            return Mouse::Left; // Or Mouse::Unknown if you have it
+namespace {
+/**
+ * @brief One entry of the key mapping list: the SFML key, our key and its name.
+ */
+struct KeyBinding {
+    sf::Keyboard::Key sfmlKey;
+    Key key;
+    const char *name;
+};
+
+// Both enums use the same enumerator names, so a single list drives the
+// forward table, the reverse table and the name table.
+#define KEY_BINDING(name) {sf::Keyboard::Key::name, Key::name, #name}
+constexpr KeyBinding KEY_BINDINGS[] = {
+    KEY_BINDING(A), KEY_BINDING(B), KEY_BINDING(C), KEY_BINDING(D),
+    KEY_BINDING(E), KEY_BINDING(F), KEY_BINDING(G), KEY_BINDING(H),
+    KEY_BINDING(I), KEY_BINDING(J), KEY_BINDING(K), KEY_BINDING(L),
+    KEY_BINDING(M), KEY_BINDING(N), KEY_BINDING(O), KEY_BINDING(P),
+    KEY_BINDING(Q), KEY_BINDING(R), KEY_BINDING(S), KEY_BINDING(T),
+    KEY_BINDING(U), KEY_BINDING(V), KEY_BINDING(W), KEY_BINDING(X),
+    KEY_BINDING(Y), KEY_BINDING(Z),
+    KEY_BINDING(Num0), KEY_BINDING(Num1), KEY_BINDING(Num2), KEY_BINDING(Num3),
+    KEY_BINDING(Num4), KEY_BINDING(Num5), KEY_BINDING(Num6), KEY_BINDING(Num7),
+    KEY_BINDING(Num8), KEY_BINDING(Num9),
+    KEY_BINDING(Escape), KEY_BINDING(LControl), KEY_BINDING(LShift),
+    KEY_BINDING(LAlt), KEY_BINDING(LSystem), KEY_BINDING(RControl),
+    KEY_BINDING(RShift), KEY_BINDING(RAlt), KEY_BINDING(RSystem),
+    KEY_BINDING(Menu), KEY_BINDING(LBracket), KEY_BINDING(RBracket),
+    KEY_BINDING(Semicolon), KEY_BINDING(Comma), KEY_BINDING(Period),
+    KEY_BINDING(Apostrophe), KEY_BINDING(Slash), KEY_BINDING(Backslash),
+    KEY_BINDING(Grave), KEY_BINDING(Equal), KEY_BINDING(Hyphen),
+    KEY_BINDING(Space), KEY_BINDING(Enter), KEY_BINDING(Backspace),
+    KEY_BINDING(Tab), KEY_BINDING(PageUp), KEY_BINDING(PageDown),
+    KEY_BINDING(End), KEY_BINDING(Home), KEY_BINDING(Insert),
+    KEY_BINDING(Delete), KEY_BINDING(Add), KEY_BINDING(Subtract),
+    KEY_BINDING(Multiply), KEY_BINDING(Divide),
+    KEY_BINDING(Left), KEY_BINDING(Right), KEY_BINDING(Up), KEY_BINDING(Down),
+    KEY_BINDING(Numpad0), KEY_BINDING(Numpad1), KEY_BINDING(Numpad2),
+    KEY_BINDING(Numpad3), KEY_BINDING(Numpad4), KEY_BINDING(Numpad5),
+    KEY_BINDING(Numpad6), KEY_BINDING(Numpad7), KEY_BINDING(Numpad8),
+    KEY_BINDING(Numpad9),
+    KEY_BINDING(F1), KEY_BINDING(F2), KEY_BINDING(F3), KEY_BINDING(F4),
+    KEY_BINDING(F5), KEY_BINDING(F6), KEY_BINDING(F7), KEY_BINDING(F8),
+    KEY_BINDING(F9), KEY_BINDING(F10), KEY_BINDING(F11), KEY_BINDING(F12),
+    KEY_BINDING(F13), KEY_BINDING(F14), KEY_BINDING(F15),
+    KEY_BINDING(Pause),
+};
+#undef KEY_BINDING
+
+constexpr std::size_t KEY_COUNT = static_cast<std::size_t>(Key::KeyCount);
+constexpr std::size_t SFML_KEY_COUNT = sf::Keyboard::KeyCount;
+constexpr std::size_t BUTTON_COUNT = static_cast<std::size_t>(Mouse::ButtonCount);
+constexpr std::size_t SFML_BUTTON_COUNT = sf::Mouse::ButtonCount;
+
+constexpr std::size_t toIndex(sf::Keyboard::Key key) {
+    return static_cast<std::size_t>(static_cast<int>(key));
+}
+constexpr std::size_t toIndex(Key key) { return static_cast<std::size_t>(key); }
+
+/**
+ * @brief Checks that every Key except Unknown is bound to exactly one distinct SFML key.
+ */
+constexpr bool isBijective() {
+    std::array<int, KEY_COUNT> keyUses{};
+    std::array<int, SFML_KEY_COUNT> sfmlUses{};
+    for (const KeyBinding &binding : KEY_BINDINGS) {
+        if (binding.key == Key::Unknown || toIndex(binding.sfmlKey) >= SFML_KEY_COUNT)
+            return false;
+        keyUses[toIndex(binding.key)]++;
+        sfmlUses[toIndex(binding.sfmlKey)]++;
     }
+    for (std::size_t key = 1; key < KEY_COUNT; key++)
+        if (keyUses[key] != 1) return false;
+    for (int uses : sfmlUses)
+        if (uses > 1) return false;
+    return true;
+}
+
+static_assert(std::size(KEY_BINDINGS) == KEY_COUNT - 1,
+              "Every Key except Unknown needs an entry in KEY_BINDINGS");
+static_assert(isBijective(),
+              "KEY_BINDINGS must map each Key to one distinct SFML key");
+static_assert(std::size(KEY_BINDINGS) == SFML_KEY_COUNT,
+              "SFML gained keys that Key does not cover");
+
+constexpr auto SFML_TO_KEY = [] {
+    std::array<Key, SFML_KEY_COUNT> table{};
+    table.fill(Key::Unknown);
+    for (const KeyBinding &binding : KEY_BINDINGS)
+        table[toIndex(binding.sfmlKey)] = binding.key;
+    return table;
+}();
+
+constexpr auto KEY_TO_SFML = [] {
+    std::array<sf::Keyboard::Key, KEY_COUNT> table{};
+    table.fill(sf::Keyboard::Key::Unknown);
+    for (const KeyBinding &binding : KEY_BINDINGS)
+        table[toIndex(binding.key)] = binding.sfmlKey;
+    return table;
+}();
+
+constexpr auto KEY_NAMES = [] {
+    std::array<const char *, KEY_COUNT> table{};
+    table.fill("Unknown");
+    for (const KeyBinding &binding : KEY_BINDINGS)
+        table[toIndex(binding.key)] = binding.name;
+    return table;
+}();
+
+// Buttons without a Mouse counterpart fall back to Left, as before.
+constexpr auto SFML_TO_MOUSE = [] {
+    std::array<Mouse, SFML_BUTTON_COUNT> table{};
+    table.fill(Mouse::Left);
+    table[static_cast<std::size_t>(sf::Mouse::Button::Right)] = Mouse::Right;
+    return table;
+}();
+
+static_assert(BUTTON_COUNT == 2, "Update SFML_TO_MOUSE when adding mouse buttons");
+}  // namespace
+
+Mouse SignalMap::mapSfmlMouseButton(sf::Mouse::Button button) {
+    std::size_t index = static_cast<std::size_t>(button);
+    return index < SFML_BUTTON_COUNT ? SFML_TO_MOUSE[index] : Mouse::Left;
 }
 
 Key SignalMap::mapSfmlKey(sf::Keyboard::Key key) {
-    switch (key) {
-        case sf::Keyboard::Key::A:
-            return Key::A;
-            case sf::Keyboard::Key::B:
-                return Key::B;
-            case sf::Keyboard::Key::C:
-                return Key::C;
-            case sf::Keyboard::Key::D:
-                return Key::D;
-            case sf::Keyboard::Key::E:
-                return Key::E;
-            case sf::Keyboard::Key::F:
-                return Key::F;
-            case sf::Keyboard::Key::G:
-                return Key::G;
-            case sf::Keyboard::Key::H:
-                return Key::H;
-            case sf::Keyboard::Key::I:
-                return Key::I;
-            case sf::Keyboard::Key::J:
-                return Key::J;
-            case sf::Keyboard::Key::K:
-                return Key::K;
-            case sf::Keyboard::Key::L:
-                return Key::L;
-            case sf::Keyboard::Key::M:
-                return Key::M;
-            case sf::Keyboard::Key::N:
-                return Key::N;
-            case sf::Keyboard::Key::O:
-                return Key::O;
-            case sf::Keyboard::Key::P:
-                return Key::P;
-            case sf::Keyboard::Key::Q:
-                return Key::Q;
-            case sf::Keyboard::Key::R:
-                return Key::R;
-            case sf::Keyboard::Key::S:
-                return Key::S;
-            case sf::Keyboard::Key::T:
-                return Key::T;
-            case sf::Keyboard::Key::U:
-                return Key::U;
-            case sf::Keyboard::Key::V:
-                return Key::V;
-            case sf::Keyboard::Key::W:
-                return Key::W;
-            case sf::Keyboard::Key::X:
-                return Key::X;
-            case sf::Keyboard::Key::Y:
-                return Key::Y;
-            case sf::Keyboard::Key::Z:
-                return Key::Z;
-            case sf::Keyboard::Key::Num0:
-                return Key::Num0;
-            case sf::Keyboard::Key::Num1:
-                return Key::Num1;
-            case sf::Keyboard::Key::Num2:
-                return Key::Num2;
-            case sf::Keyboard::Key::Num3:
-                return Key::Num3;
-            case sf::Keyboard::Key::Num4:
-                return Key::Num4;
-            case sf::Keyboard::Key::Num5:
-                return Key::Num5;
-            case sf::Keyboard::Key::Num6:
-                return Key::Num6;
-            case sf::Keyboard::Key::Num7:
-                return Key::Num7;
-            case sf::Keyboard::Key::Num8:
-                return Key::Num8;
-            case sf::Keyboard::Key::Num9:
-                return Key::Num9;
-            case sf::Keyboard::Key::Escape:
-                return Key::Escape;
-            case sf::Keyboard::Key::LControl:
-                return Key::LControl;
-            case sf::Keyboard::Key::LShift:
-                return Key::LShift;
-            case sf::Keyboard::Key::LAlt:
-                return Key::LAlt;
-            case sf::Keyboard::Key::LSystem:
-                return Key::LSystem;
-            case sf::Keyboard::Key::RControl:
-                return Key::RControl;
-            case sf::Keyboard::Key::RShift:
-                return Key::RShift;
-            case sf::Keyboard::Key::RAlt:
-                return Key::RAlt;
-            case sf::Keyboard::Key::RSystem:
-                return Key::RSystem;
-            case sf::Keyboard::Key::Menu:
-                return Key::Menu;
-            case sf::Keyboard::Key::LBracket:
-                return Key::LBracket;
-            case sf::Keyboard::Key::RBracket:
-                return Key::RBracket;
-            case sf::Keyboard::Key::Semicolon:
-                return Key::Semicolon;
-            case sf::Keyboard::Key::Comma:
-                return Key::Comma;
-            case sf::Keyboard::Key::Period:
-                return Key::Period;
-            case sf::Keyboard::Key::Apostrophe:
-                return Key::Apostrophe;
-            case sf::Keyboard::Key::Slash:
-                return Key::Slash;
-            case sf::Keyboard::Key::Backslash:
-                return Key::Backslash;
-            case sf::Keyboard::Key::Grave:
-                return Key::Grave;
-            case sf::Keyboard::Key::Equal:
-                return Key::Equal;
-            case sf::Keyboard::Key::Hyphen:
-                return Key::Hyphen;
-            case sf::Keyboard::Key::Space:
-                return Key::Space;
-            case sf::Keyboard::Key::Enter:
-                return Key::Enter;
-            case sf::Keyboard::Key::Backspace:
-                return Key::Backspace;
-            case sf::Keyboard::Key::Tab:
-                return Key::Tab;
-            case sf::Keyboard::Key::PageUp:
-                return Key::PageUp;
-            case sf::Keyboard::Key::PageDown:
-                return Key::PageDown;
-            case sf::Keyboard::Key::End:
-                return Key::End;
-            case sf::Keyboard::Key::Home:
-                return Key::Home;
-            case sf::Keyboard::Key::Insert:
-                return Key::Insert;
-            case sf::Keyboard::Key::Delete:
-                return Key::Delete;
-            case sf::Keyboard::Key::Add:
-                return Key::Add;
-            case sf::Keyboard::Key::Subtract:
-                return Key::Subtract;
-            case sf::Keyboard::Key::Multiply:
-                return Key::Multiply;
-            case sf::Keyboard::Key::Divide:
-                return Key::Divide;
-            case sf::Keyboard::Key::Left:
-                return Key::Left;
-            case sf::Keyboard::Key::Right:
-                return Key::Right;
-            case sf::Keyboard::Key::Up:
-                return Key::Up;
-            case sf::Keyboard::Key::Down:
-                return Key::Down;
-            case sf::Keyboard::Key::Numpad0:
-                return Key::Numpad0;
-            case sf::Keyboard::Key::Numpad1:
-                return Key::Numpad1;
-            case sf::Keyboard::Key::Numpad2:
-                return Key::Numpad2;
-            case sf::Keyboard::Key::Numpad3:
-                return Key::Numpad3;
-            case sf::Keyboard::Key::Numpad4:
-                return Key::Numpad4;
-            case sf::Keyboard::Key::Numpad5:
-                return Key::Numpad5;
-            case sf::Keyboard::Key::Numpad6:
-                return Key::Numpad6;
-            case sf::Keyboard::Key::Numpad7:
-                return Key::Numpad7;
-            case sf::Keyboard::Key::Numpad8:
-                return Key::Numpad8;
-            case sf::Keyboard::Key::Numpad9:
-                return Key::Numpad9;
-            case sf::Keyboard::Key::F1:
-                return Key::F1;
-            case sf::Keyboard::Key::F2:
-                return Key::F2;
-            case sf::Keyboard::Key::F3:
-                return Key::F3;
-            case sf::Keyboard::Key::F4:
-                return Key::F4;
-            case sf::Keyboard::Key::F5:
-                return Key::F5;
-            case sf::Keyboard::Key::F6:
-                return Key::F6;
-            case sf::Keyboard::Key::F7:
-                return Key::F7;
-            case sf::Keyboard::Key::F8:
-                return Key::F8;
-            case sf::Keyboard::Key::F9:
-                return Key::F9;
-            case sf::Keyboard::Key::F10:
-                return Key::F10;
-            case sf::Keyboard::Key::F11:
-                return Key::F11;
-            case sf::Keyboard::Key::F12:
-                return Key::F12;
-            case sf::Keyboard::Key::F13:
-                return Key::F13;
-            case sf::Keyboard::Key::F14:
-                return Key::F14;
-            case sf::Keyboard::Key::F15:
-                return Key::F15;
-            case sf::Keyboard::Key::Pause:
-                return Key::Pause;
-            default:
-                return Key::Unknown;
-    }
-}
\ No newline at end of file
+    // sf::Keyboard::Key::Unknown is -1 and wraps past the end of the table.
+    std::size_t index = toIndex(key);
+    return index < SFML_KEY_COUNT ? SFML_TO_KEY[index] : Key::Unknown;
+}
+
+sf::Keyboard::Key SignalMap::mapKeyToSfml(Key key) {
+    std::size_t index = toIndex(key);
+    return index < KEY_COUNT ? KEY_TO_SFML[index] : sf::Keyboard::Key::Unknown;
+}
+
+const char *SignalMap::getKeyName(Key key) {
+    std::size_t index = toIndex(key);
+    return index < KEY_COUNT ? KEY_NAMES[index] : KEY_NAMES[0];
+}
+
+Key SignalMap::findKey(std::string_view name) {
+    for (const KeyBinding &binding : KEY_BINDINGS)
+        if (name == binding.name) return binding.key;
+    return Key::Unknown;
+}
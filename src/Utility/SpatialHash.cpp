@@ -0,0 +1,201 @@
+#include "Utility/SpatialHash.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+SpatialHash::SpatialHash(float cellSize)
+    : cellSize{cellSize > 0.f ? cellSize : 1.f}, inverseCellSize{1.f / this->cellSize} {}
+
+float SpatialHash::suggestCellSize(float worldArea, std::size_t expectedItems, float itemsPerCell) {
+    if (expectedItems == 0 || worldArea <= 0.f) return std::sqrt(std::max(worldArea, 1.f));
+    return std::sqrt(worldArea * itemsPerCell / static_cast<float>(expectedItems));
+}
+
+void SpatialHash::setCellSize(float newCellSize) {
+    std::vector<Item> oldItems;
+    oldItems.swap(items);
+    cells.clear();
+    itemCount = 0;
+    cellSize = newCellSize > 0.f ? newCellSize : 1.f;
+    inverseCellSize = 1.f / cellSize;
+    for (std::uint32_t id = 0; id < oldItems.size(); id++)
+        if (oldItems[id].maxX >= oldItems[id].minX) insert(id, oldItems[id].bounds);
+}
+
+int SpatialHash::toCell(float coordinate) const {
+    return static_cast<int>(std::floor(coordinate * inverseCellSize));
+}
+
+void SpatialHash::link(std::uint32_t id) {
+    const Item &item = items[id];
+    for (int y = item.minY; y <= item.maxY; y++)
+        for (int x = item.minX; x <= item.maxX; x++) cells[cellKey(x, y)].push_back(id);
+}
+
+void SpatialHash::unlink(std::uint32_t id) {
+    const Item &item = items[id];
+    for (int y = item.minY; y <= item.maxY; y++) {
+        for (int x = item.minX; x <= item.maxX; x++) {
+            auto cell = cells.find(cellKey(x, y));
+            if (cell == cells.end()) continue;
+            auto &ids = cell->second;
+            auto found = std::find(ids.begin(), ids.end(), id);
+            if (found == ids.end()) continue;
+            *found = ids.back();
+            ids.pop_back();
+            // Empty cells keep their storage: items tend to come back.
+        }
+    }
+}
+
+std::uint32_t SpatialHash::nextStamp() const {
+    if (visitStamp.size() < items.size()) visitStamp.resize(items.size(), 0);
+    if (++queryStamp == 0) {
+        std::fill(visitStamp.begin(), visitStamp.end(), 0);
+        queryStamp = 1;
+    }
+    return queryStamp;
+}
+
+template <typename Function>
+void SpatialHash::visitCells(int minX, int minY, int maxX, int maxY, Function &&function) const {
+    const std::uint32_t stamp = queryStamp;
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            auto cell = cells.find(cellKey(x, y));
+            if (cell == cells.end()) continue;
+            for (std::uint32_t id : cell->second) {
+                if (visitStamp[id] == stamp) continue;
+                visitStamp[id] = stamp;
+                function(id);
+            }
+        }
+    }
+}
+
+void SpatialHash::insert(std::uint32_t id, const sf::FloatRect &bounds) {
+    if (id >= items.size()) items.resize(id + 1);
+    Item &item = items[id];
+    int minX = toCell(bounds.position.x);
+    int minY = toCell(bounds.position.y);
+    int maxX = toCell(bounds.position.x + bounds.size.x);
+    int maxY = toCell(bounds.position.y + bounds.size.y);
+    bool present = contains(id);
+    if (present && minX == item.minX && minY == item.minY && maxX == item.maxX &&
+        maxY == item.maxY) {
+        item.bounds = bounds;
+        return;
+    }
+    if (present)
+        unlink(id);
+    else
+        itemCount++;
+    item.bounds = bounds;
+    item.minX = minX;
+    item.minY = minY;
+    item.maxX = maxX;
+    item.maxY = maxY;
+    link(id);
+}
+
+void SpatialHash::remove(std::uint32_t id) {
+    if (!contains(id)) return;
+    unlink(id);
+    items[id].minX = 0;
+    items[id].maxX = -1;
+    itemCount--;
+}
+
+void SpatialHash::clear() {
+    items.clear();
+    cells.clear();
+    visitStamp.clear();
+    itemCount = 0;
+}
+
+float SpatialHash::distanceSquared(std::uint32_t id, sf::Vector2f point) const {
+    const sf::FloatRect &bounds = items[id].bounds;
+    float dx = std::max({bounds.position.x - point.x, 0.f,
+                         point.x - (bounds.position.x + bounds.size.x)});
+    float dy = std::max({bounds.position.y - point.y, 0.f,
+                         point.y - (bounds.position.y + bounds.size.y)});
+    return dx * dx + dy * dy;
+}
+
+void SpatialHash::queryRadius(sf::Vector2f center, float radius,
+                              std::vector<std::uint32_t> &result) const {
+    result.clear();
+    if (itemCount == 0) return;
+    nextStamp();
+    const float radiusSquared = radius * radius;
+    visitCells(toCell(center.x - radius), toCell(center.y - radius), toCell(center.x + radius),
+               toCell(center.y + radius), [&](std::uint32_t id) {
+                   if (distanceSquared(id, center) <= radiusSquared) result.push_back(id);
+               });
+}
+
+void SpatialHash::queryRect(const sf::FloatRect &area, std::vector<std::uint32_t> &result) const {
+    result.clear();
+    if (itemCount == 0) return;
+    nextStamp();
+    const float areaRight = area.position.x + area.size.x;
+    const float areaBottom = area.position.y + area.size.y;
+    visitCells(toCell(area.position.x), toCell(area.position.y), toCell(areaRight),
+               toCell(areaBottom), [&](std::uint32_t id) {
+                   const sf::FloatRect &bounds = items[id].bounds;
+                   bool overlapsX = bounds.position.x <= areaRight &&
+                                    area.position.x <= bounds.position.x + bounds.size.x;
+                   bool overlapsY = bounds.position.y <= areaBottom &&
+                                    area.position.y <= bounds.position.y + bounds.size.y;
+                   if (overlapsX && overlapsY) result.push_back(id);
+               });
+}
+
+void SpatialHash::queryNearest(sf::Vector2f center, std::size_t count, float maxRadius,
+                               std::vector<std::uint32_t> &result) const {
+    result.clear();
+    if (itemCount == 0 || count == 0) return;
+    nextStamp();
+    nearestHeap.clear();
+    const float maxRadiusSquared = maxRadius * maxRadius;
+    std::size_t visited = 0;
+    auto consider = [&](std::uint32_t id) {
+        visited++;
+        float distance = distanceSquared(id, center);
+        if (distance > maxRadiusSquared) return;
+        if (nearestHeap.size() == count) {
+            if (distance >= nearestHeap.front().first) return;
+            std::pop_heap(nearestHeap.begin(), nearestHeap.end());
+            nearestHeap.pop_back();
+        }
+        nearestHeap.push_back({distance, id});
+        std::push_heap(nearestHeap.begin(), nearestHeap.end());
+    };
+
+    const int centerX = toCell(center.x);
+    const int centerY = toCell(center.y);
+    for (int ring = 0;; ring++) {
+        if (ring == 0) {
+            visitCells(centerX, centerY, centerX, centerY, consider);
+        } else {
+            visitCells(centerX - ring, centerY - ring, centerX + ring, centerY - ring, consider);
+            visitCells(centerX - ring, centerY + ring, centerX + ring, centerY + ring, consider);
+            visitCells(centerX - ring, centerY - ring + 1, centerX - ring, centerY + ring - 1, consider);
+            visitCells(centerX + ring, centerY - ring + 1, centerX + ring, centerY + ring - 1, consider);
+        }
+        if (visited == itemCount) break;
+        // Anything not seen yet lies outside the square of cells searched so
+        // far, so it is at least as far away as that square's nearest edge.
+        float reach = std::min({center.x - (centerX - ring) * cellSize,
+                                (centerX + ring + 1) * cellSize - center.x,
+                                center.y - (centerY - ring) * cellSize,
+                                (centerY + ring + 1) * cellSize - center.y});
+        if (reach > maxRadius) break;
+        if (nearestHeap.size() == count && reach * reach >= nearestHeap.front().first) break;
+    }
+
+    std::sort_heap(nearestHeap.begin(), nearestHeap.end());
+    result.reserve(nearestHeap.size());
+    for (auto [distance, id] : nearestHeap) result.push_back(id);
+}
@@ -0,0 +1,40 @@
+#include "Utility/ThreadPool.hpp"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(std::size_t threadCount) {
+    threadCount = std::max<std::size_t>(threadCount, 1);
+    workers.reserve(threadCount);
+    for (std::size_t index = 0; index < threadCount; index++)
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+}
+
+ThreadPool::~ThreadPool() {
+    std::deque<std::function<void()>> discarded;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        discarded.swap(tasks);
+    }
+    wakeUp.notify_all();
+    for (auto &worker : workers) worker.join();
+}
+
+void ThreadPool::workerLoop() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeUp.wait(lock, [this]() { return stopping || !tasks.empty(); });
+            if (stopping) return;
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+std::size_t ThreadPool::defaultThreadCount() {
+    unsigned hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+}
@@ -1,11 +1,131 @@
 #include "Utility/logger.hpp"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <iomanip>
 #include <ctime>
 #include <iostream>
+#include <memory>
+#include <thread>
+
+#include "Utility/MpscQueue.hpp"
 
 const char* Logger::RESET_COLOR = "\033[0m";
 
+namespace {
+constexpr std::size_t RECORD_TEXT_SIZE = 232;  ///< Longer messages are truncated.
+constexpr std::size_t MAX_BATCH_RECORDS = 256;  ///< Records written per flush.
+
+/**
+ * @brief A preformatted message waiting in the ring buffer. Fixed size, so
+ * producers never allocate.
+ */
+struct LogRecord {
+    std::chrono::system_clock::time_point time;
+    LogLevel level = LogLevel::INFO;
+    std::uint16_t length = 0;
+    bool truncated = false;
+    char text[RECORD_TEXT_SIZE];
+};
+
+/**
+ * @brief Plain-text file sink that rotates path -> path.1 -> ... -> path.N.
+ */
+class RotatingFileSink {
+   private:
+    std::filesystem::path path;
+    std::size_t maxFileSize;
+    int maxFiles;
+    std::ofstream file;
+    std::size_t currentSize = 0;
+
+    std::filesystem::path rotatedPath(int index) const {
+        return std::filesystem::path(path.string() + "." + std::to_string(index));
+    }
+
+    void rotate() {
+        file.close();
+        std::error_code error;
+        std::filesystem::remove(rotatedPath(maxFiles), error);
+        for (int index = maxFiles - 1; index >= 1; index--)
+            std::filesystem::rename(rotatedPath(index), rotatedPath(index + 1), error);
+        if (maxFiles > 0)
+            std::filesystem::rename(path, rotatedPath(1), error);
+        file.open(path, std::ios::binary | std::ios::trunc);
+        currentSize = 0;
+    }
+
+   public:
+    RotatingFileSink(const std::string &path, std::size_t maxFileSize, int maxFiles)
+        : path{path}, maxFileSize{maxFileSize}, maxFiles{maxFiles} {
+        std::error_code error;
+        currentSize = static_cast<std::size_t>(std::filesystem::file_size(path, error));
+        if (error) currentSize = 0;
+        file.open(path, std::ios::binary | std::ios::app);
+    }
+
+    bool isOpen() const { return file.is_open(); }
+
+    void write(std::string_view data) {
+        if (currentSize > 0 && currentSize + data.size() > maxFileSize) rotate();
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+        currentSize += data.size();
+    }
+
+    void flush() { file.flush(); }
+};
+
+/**
+ * @brief State of the background logging thread.
+ */
+struct AsyncBackend {
+    AsyncLogConfig config;
+    MpscQueue<LogRecord> queue;
+    std::unique_ptr<RotatingFileSink> fileSink;
+    std::atomic<bool> running{true};
+    std::thread worker;
+
+    explicit AsyncBackend(const AsyncLogConfig &config)
+        : config{config}, queue{config.capacity} {}
+};
+
+std::atomic<AsyncBackend *> activeBackend{nullptr};
+std::atomic<std::uint64_t> droppedRecords{0};
+std::atomic<std::uint32_t> backendUsers{0};  ///< Log calls currently holding activeBackend.
+
+/**
+ * @brief Stops the backend at static destruction if the program forgot to.
+ */
+struct AsyncShutdownGuard {
+    ~AsyncShutdownGuard() { Logger::stopAsync(); }
+} shutdownGuard;
+
+/**
+ * @brief Formats "YYYY-MM-DD HH:MM:SS", calling localtime at most once per second.
+ */
+class TimestampCache {
+   private:
+    std::time_t cachedSecond = -1;
+    char text[32] = {};
+    std::size_t length = 0;
+
+   public:
+    std::string_view format(std::chrono::system_clock::time_point time) {
+        std::time_t second = std::chrono::system_clock::to_time_t(time);
+        if (second != cachedSecond) {
+            cachedSecond = second;
+            std::tm tm = *std::localtime(&second);
+            length = std::strftime(text, sizeof(text), "%Y-%m-%d %H:%M:%S", &tm);
+        }
+        return {text, length};
+    }
+};
+}  // namespace
+
 const char* Logger::getColorCode(LogLevel level) {
     switch (level) {
         case LogLevel::TRACE:       return "\033[37m";      // White
@@ -42,7 +162,120 @@ const char* Logger::getLevelName(LogLevel level) {
     }
 }
 
-void Logger::log(LogLevel level, const std::string& message) {
+void Logger::startAsync(const AsyncLogConfig& config) {
+    if (activeBackend.load(std::memory_order_acquire) != nullptr) return;
+    auto* backend = new AsyncBackend(config);
+    if (!config.filePath.empty()) {
+        backend->fileSink = std::make_unique<RotatingFileSink>(
+            config.filePath, config.maxFileSize, config.maxFiles);
+        if (!backend->fileSink->isOpen()) {
+            backend->fileSink.reset();
+            log(LogLevel::ERROR, "Cannot open log file: " + config.filePath);
+        }
+    }
+    backend->worker = std::thread([backend] {
+        TimestampCache timestamps;
+        std::string consoleBatch;
+        std::string fileBatch;
+        consoleBatch.reserve(MAX_BATCH_RECORDS * 128);
+        fileBatch.reserve(MAX_BATCH_RECORDS * 128);
+        std::uint64_t reportedDrops = droppedRecords.load(std::memory_order_relaxed);
+        LogRecord record;
+
+        auto append = [&](LogLevel level, std::string_view time,
+                          std::string_view message, bool truncated) {
+            const char* levelName = getLevelName(level);
+            if (backend->config.writeToConsole) {
+                consoleBatch.append(getColorCode(level));
+                consoleBatch.append("[").append(time).append("] [");
+                consoleBatch.append(levelName).append("] ").append(message);
+                if (truncated) consoleBatch.append("...");
+                consoleBatch.append(RESET_COLOR).append("\n");
+            }
+            if (backend->fileSink) {
+                fileBatch.append("[").append(time).append("] [");
+                fileBatch.append(levelName).append("] ").append(message);
+                if (truncated) fileBatch.append("...");
+                fileBatch.append("\n");
+            }
+        };
+
+        for (;;) {
+            // Read the flag before draining so nothing pushed before stopAsync is lost.
+            bool keepRunning = backend->running.load(std::memory_order_acquire);
+            std::size_t count = 0;
+            while (count < MAX_BATCH_RECORDS && backend->queue.tryPop(record)) {
+                append(record.level, timestamps.format(record.time),
+                       std::string_view(record.text, record.length), record.truncated);
+                count++;
+            }
+            std::uint64_t drops = droppedRecords.load(std::memory_order_relaxed);
+            if (drops != reportedDrops) {
+                std::string notice = std::to_string(drops - reportedDrops) +
+                                     " log records dropped (buffer full)";
+                append(LogLevel::WARNING,
+                       timestamps.format(std::chrono::system_clock::now()), notice,
+                       false);
+                reportedDrops = drops;
+            }
+            if (!consoleBatch.empty()) {
+                std::cout.write(consoleBatch.data(),
+                                static_cast<std::streamsize>(consoleBatch.size()));
+                std::cout.flush();
+                consoleBatch.clear();
+            }
+            if (!fileBatch.empty()) {
+                backend->fileSink->write(fileBatch);
+                backend->fileSink->flush();
+                fileBatch.clear();
+            }
+            if (count == MAX_BATCH_RECORDS) continue;
+            if (!keepRunning) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    activeBackend.store(backend, std::memory_order_release);
+}
+
+void Logger::stopAsync() {
+    AsyncBackend* backend = activeBackend.exchange(nullptr);
+    if (backend == nullptr) return;
+    // Log calls that loaded the pointer before the exchange may still push (or
+    // wait for room under Block), so keep the worker draining until they leave.
+    while (backendUsers.load() != 0) std::this_thread::yield();
+    backend->running.store(false, std::memory_order_release);
+    backend->worker.join();
+    delete backend;
+}
+
+std::uint64_t Logger::getDroppedCount() {
+    return droppedRecords.load(std::memory_order_relaxed);
+}
+
+void Logger::log(LogLevel level, std::string_view message) {
+    if (!isEnabled(level)) return;
+    // Sequentially consistent with stopAsync: either it sees this caller and
+    // waits, or this load already sees the backend gone.
+    backendUsers.fetch_add(1);
+    if (AsyncBackend* backend = activeBackend.load()) {
+        LogRecord record;
+        record.time = std::chrono::system_clock::now();
+        record.level = level;
+        std::size_t length = std::min(message.size(), RECORD_TEXT_SIZE);
+        std::memcpy(record.text, message.data(), length);
+        record.length = static_cast<std::uint16_t>(length);
+        record.truncated = length < message.size();
+        while (!backend->queue.tryPush(std::move(record))) {
+            if (backend->config.overflowPolicy == LogOverflowPolicy::Drop) {
+                droppedRecords.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+            std::this_thread::yield();
+        }
+        backendUsers.fetch_sub(1, std::memory_order_release);
+        return;
+    }
+    backendUsers.fetch_sub(1, std::memory_order_release);
     auto now = std::chrono::system_clock::now();
     auto time_t = std::chrono::system_clock::to_time_t(now);
     auto tm = *std::localtime(&time_t);
@@ -54,50 +287,42 @@ void Logger::log(LogLevel level, const std::string& message) {
               << RESET_COLOR << std::endl;
 }
 
-void Logger::trace(const std::string& message) {
-    log(LogLevel::TRACE, message);
-}
-
-void Logger::debug(const std::string& message) {
-    log(LogLevel::DEBUGG, message);
-}
-
-void Logger::info(const std::string& message) {
+void Logger::info(std::string_view message) {
     log(LogLevel::INFO, message);
 }
 
-void Logger::success(const std::string& message) {
+void Logger::success(std::string_view message) {
     log(LogLevel::SUCCESS, message);
 }
 
-void Logger::warning(const std::string& message) {
+void Logger::warning(std::string_view message) {
     log(LogLevel::WARNING, message);
 }
 
-void Logger::error(const std::string& message) {
+void Logger::error(std::string_view message) {
     log(LogLevel::ERROR, message);
 }
 
-void Logger::critical(const std::string& message) {
+void Logger::critical(std::string_view message) {
     log(LogLevel::CRITICAL, message);
 }
 
-void Logger::exception(const std::string& message) {
+void Logger::exception(std::string_view message) {
     log(LogLevel::EXCEPTION, message);
 }
 
-void Logger::network(const std::string& message) {
+void Logger::network(std::string_view message) {
     log(LogLevel::NETWORK, message);
 }
 
-void Logger::performance(const std::string& message) {
+void Logger::performance(std::string_view message) {
     log(LogLevel::PERFORMANCE, message);
 }
 
-void Logger::memory(const std::string& message) {
+void Logger::memory(std::string_view message) {
     log(LogLevel::MEMORY, message);
 }
 
-void Logger::security(const std::string& message) {
+void Logger::security(std::string_view message) {
     log(LogLevel::SECURITY, message);
 }
@@ -1,18 +1,38 @@
 #include <SFML/Graphics.hpp>
 #include <optional>
+#include <string>
+#include <string_view>
 
 #include "Utility/logger.hpp"
 #include "Core/Application.hpp"
 #include "Core/ResourceManager.hpp"
-int main() {
+int main(int argc, char **argv) {
+    // Keep formatting and console I/O off the game loop thread.
+    Logger::startAsync();
     Logger::success("Program start");
     
 
 
     
-    Application mainLoop;
-    mainLoop.run();
+    // --threaded runs simulation and rendering on their own threads,
+    // --record <file> captures input for SceneBenchmark --replay
+    ApplicationOptions options;
+    for (int index = 1; index < argc; index++) {
+        std::string_view argument = argv[index];
+        if (argument == "--threaded")
+            options.threaded = true;
+        else if (argument == "--record" && index + 1 < argc)
+            options.recordPath = argv[++index];
+        else
+            Logger::warning("Ignoring unknown argument: " + std::string(argument));
+    }
+    {
+        // Scoped so the application and its threads are gone before the logger stops.
+        Application mainLoop(options);
+        mainLoop.run();
+    }
     
     Logger::success("Program exit success");
+    Logger::stopAsync();
 }
 
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "Core/AssetPack.hpp"
+
+namespace {
+AssetPack::Source makeSource(const std::string &name, const std::string &contents) {
+    AssetPack::Source source{name, {}};
+    for (char character : contents) source.data.push_back(static_cast<std::byte>(character));
+    return source;
+}
+
+std::string toString(std::span<const std::byte> bytes) {
+    return {reinterpret_cast<const char *>(bytes.data()), bytes.size()};
+}
+}  // namespace
+
+TEST(assetPackTest, servesFilesFromTheMapping) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "assetPackTest.pack";
+    {
+        std::ofstream file(path, std::ios::binary);
+        ASSERT_TRUE(AssetPack::write(file, {makeSource("assets/sounds/coin.wav", "RIFF coin"),
+                                            makeSource("assets/empty.txt", ""),
+                                            makeSource("assets/fonts/main.ttf", "font bytes")}));
+    }
+
+    AssetPack pack;
+    ASSERT_TRUE(pack.open(path));
+    EXPECT_EQ(pack.size(), 3u);
+    std::span<const std::byte> coin = pack.find("assets/sounds/coin.wav");
+    EXPECT_EQ(toString(coin), "RIFF coin");
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(coin.data()) % AssetPack::ALIGNMENT, 0u);
+    EXPECT_EQ(toString(pack.find("assets/fonts/main.ttf")), "font bytes");
+    EXPECT_TRUE(pack.contains("assets/empty.txt"));
+    EXPECT_FALSE(pack.contains("assets/missing.png"));
+    EXPECT_EQ(pack.find("assets/missing.png").size(), 0u);
+    pack.close();
+    std::filesystem::remove(path);
+}
+
+TEST(assetPackTest, rejectsInvalidFiles) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "assetPackTest.bad";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "APAK but not really a pack";
+    }
+    AssetPack pack;
+    EXPECT_FALSE(pack.open(path));
+    EXPECT_FALSE(pack.isOpen());
+    EXPECT_FALSE(pack.open(std::filesystem::temp_directory_path() / "assetPackTest.missing"));
+    std::filesystem::remove(path);
+}
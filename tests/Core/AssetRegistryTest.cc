@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "Core/AssetRegistry.hpp"
+#include "Utility/StringId.hpp"
+
+namespace {
+struct TestTag {};
+using TestRegistry = AssetRegistry<int, TestTag>;
+}  // namespace
+
+TEST(stringIdTest, literalMatchesRuntimeHash) {
+    static_assert("coin"_sid == StringId::hash("coin"));
+    EXPECT_NE(("coin"_sid).value, ("coins"_sid).value);
+}
+
+TEST(assetRegistryTest, resolvesHandles) {
+    TestRegistry registry;
+    auto handle = registry.add("coin", std::make_unique<int>(7));
+    ASSERT_TRUE(handle.isValid());
+    EXPECT_EQ(*registry.get(handle), 7);
+    EXPECT_EQ(registry.find("coin"_sid), handle);
+    EXPECT_EQ(registry.find("coin"), handle);
+    EXPECT_EQ(registry.getName(handle), "coin");
+    EXPECT_FALSE(registry.find("missing").isValid());
+    EXPECT_FALSE(registry.add("coin", std::make_unique<int>(8)).isValid());
+}
+
+TEST(assetRegistryTest, detectsStaleHandles) {
+    TestRegistry registry;
+    auto first = registry.add("first", std::make_unique<int>(1));
+    EXPECT_TRUE(registry.remove(first));
+    EXPECT_EQ(registry.get(first), nullptr);
+    EXPECT_FALSE(registry.remove(first));
+
+    auto second = registry.add("second", std::make_unique<int>(2));
+    EXPECT_EQ(second.index, first.index);
+    EXPECT_EQ(registry.get(first), nullptr);
+    EXPECT_EQ(*registry.get(second), 2);
+    EXPECT_FALSE(registry.find("first").isValid());
+    EXPECT_EQ(registry.size(), 1u);
+    EXPECT_EQ(registry.get({}), nullptr);
+}
@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "Core/AtlasManifest.hpp"
+
+TEST(atlasManifestTest, roundTrips) {
+    AtlasManifest manifest;
+    manifest.pages = {"sprites_0.png", "sprites_1.png"};
+    manifest.sprites.push_back({"enemies/slime", 1, sf::IntRect({3, 4}, {16, 24})});
+    manifest.sprites.push_back({"coin", 0, sf::IntRect({0, 0}, {8, 8})});
+    std::stringstream stream;
+    ASSERT_TRUE(manifest.write(stream));
+
+    AtlasManifest loaded;
+    ASSERT_TRUE(loaded.read(stream));
+    EXPECT_EQ(loaded.pages, manifest.pages);
+    ASSERT_EQ(loaded.sprites.size(), 2u);
+    EXPECT_EQ(loaded.sprites[0].name, "enemies/slime");
+    EXPECT_EQ(loaded.sprites[0].page, 1);
+    EXPECT_EQ(loaded.sprites[0].rect.position.y, 4);
+    EXPECT_EQ(loaded.sprites[0].rect.size.y, 24);
+}
+
+TEST(atlasManifestTest, rejectsTruncatedData) {
+    AtlasManifest manifest;
+    manifest.pages = {"sprites_0.png"};
+    manifest.sprites.push_back({"coin", 0, sf::IntRect({0, 0}, {8, 8})});
+    std::stringstream stream;
+    ASSERT_TRUE(manifest.write(stream));
+    std::string data = stream.str();
+    std::istringstream truncated(data.substr(0, data.size() - 3));
+    EXPECT_FALSE(manifest.read(truncated));
+    std::istringstream garbage("not an atlas");
+    EXPECT_FALSE(manifest.read(garbage));
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include "Core/EntityStore.hpp"
+
+TEST(entityStoreTest, createAndDestroy) {
+    EntityStore store;
+    Entity first = store.create(Component::Position | Component::Velocity);
+    Entity second = store.create();
+    Entity third = store.create(Component::Position | Component::Health);
+    store.setPosition(third, {5.f, 6.f});
+    EXPECT_EQ(store.size(), 3u);
+
+    store.destroy(first);
+    EXPECT_FALSE(store.isAlive(first));
+    EXPECT_TRUE(store.isAlive(second));
+    EXPECT_EQ(store.size(), 2u);
+    // The last row moved into the hole and must still be reachable by entity.
+    EXPECT_EQ(store.position(third), sf::Vector2f(5.f, 6.f));
+    EXPECT_TRUE(store.hasComponents(third, Component::Health));
+
+    Entity reused = store.create();
+    EXPECT_EQ(reused.index, first.index);
+    EXPECT_FALSE(store.isAlive(first));
+    EXPECT_FALSE(store.hasComponents(first, Component::Position));
+    store.destroy(first);
+    EXPECT_EQ(store.size(), 3u);
+}
+
+TEST(entityStoreTest, integrateMovesOnlyMovingEntities) {
+    EntityStore store;
+    Entity moving = store.create(Component::Position | Component::Velocity);
+    Entity still = store.create(Component::Position);
+    store.velocity(moving) = {2.f, 0.f};
+    store.velocity(still) = {9.f, 9.f};
+    store.integrate();
+    store.integrate();
+    EXPECT_EQ(store.position(moving), sf::Vector2f(4.f, 0.f));
+    EXPECT_EQ(store.position(still), sf::Vector2f(0.f, 0.f));
+    std::size_t row = store.rowOfEntity(moving);
+    EXPECT_EQ(store.getInterpolatedPosition(row, 0.5f), sf::Vector2f(3.f, 0.f));
+}
+
+TEST(entityStoreTest, queueDeadIsDeferred) {
+    EntityStore store;
+    for (int index = 0; index < 10; index++) {
+        Entity entity = store.create(Component::Position | Component::Health);
+        store.health(entity) = {index % 2 == 0 ? 0.f : 5.f, 5.f};
+    }
+    EXPECT_EQ(store.queueDead(), 5u);
+    EXPECT_EQ(store.size(), 10u);
+    store.flushDestroyed();
+    EXPECT_EQ(store.size(), 5u);
+    for (const HealthComponent &health : store.getHealths()) EXPECT_GT(health.current, 0.f);
+}
@@ -0,0 +1,27 @@
+#include <gtest/gtest.h>
+
+#include "Core/FixedTimestep.hpp"
+
+TEST(fixedTimestepTest, wholeTicks) {
+    FixedTimestep timestep(0.01f, 5);
+    EXPECT_EQ(timestep.advance(0.025f), 2);
+    EXPECT_NEAR(timestep.getAlpha(), 0.5f, 1e-3f);
+    EXPECT_EQ(timestep.advance(0.005f), 1);
+    EXPECT_EQ(timestep.getTickCount(), 3u);
+}
+
+TEST(fixedTimestepTest, accumulatesShortFrames) {
+    FixedTimestep timestep(0.01f, 5);
+    EXPECT_EQ(timestep.advance(0.004f), 0);
+    EXPECT_EQ(timestep.advance(0.004f), 0);
+    EXPECT_EQ(timestep.advance(0.004f), 1);
+}
+
+TEST(fixedTimestepTest, capsCatchUp) {
+    FixedTimestep timestep(0.01f, 5);
+    EXPECT_EQ(timestep.advance(1.f), 5);
+    EXPECT_GT(timestep.getDroppedTime(), 0.9f);
+    // The stall is forgotten instead of being paid back over later frames.
+    EXPECT_LE(timestep.advance(0.01f), 2);
+    EXPECT_LT(timestep.getAlpha(), 1.f);
+}
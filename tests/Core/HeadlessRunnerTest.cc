@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "Base/Constants.hpp"
+#include "Core/HeadlessRunner.hpp"
+#include "Scene/BlankScene.hpp"
+
+namespace {
+class CountingScene : public BlankScene {
+   public:
+    mutable int draws = 0;
+    int updates = 0;
+    int subticks = 0;
+    CountingScene(sf::RenderTarget &target, const std::string &name) : BlankScene{target, name} {}
+    void update() override { updates++; }
+    void subtick() override { subticks++; }
+    void draw(sf::RenderTarget &, sf::RenderStates) const override { draws++; }
+};
+}  // namespace
+
+TEST(headlessRunnerTest, parseScript) {
+    std::istringstream input(
+        "# comment\n"
+        "\n"
+        "30 mouse_press Left 400 300\n"
+        "10 key_press Space\n"
+        "12 key_release NotAKey\n"
+        "40 mouse_move 100 200\n");
+    auto script = HeadlessRunner::parseScript(input);
+    ASSERT_EQ(script.size(), 3u);
+    EXPECT_EQ(script[0].tick, 10u);
+    ASSERT_TRUE(script[0].event.is<sf::Event::KeyPressed>());
+    EXPECT_EQ(script[0].event.getIf<sf::Event::KeyPressed>()->code, sf::Keyboard::Key::Space);
+    EXPECT_EQ(script[1].tick, 30u);
+    const auto *press = script[1].event.getIf<sf::Event::MouseButtonPressed>();
+    ASSERT_NE(press, nullptr);
+    EXPECT_EQ(press->button, sf::Mouse::Button::Left);
+    EXPECT_EQ(press->position, sf::Vector2i(400, 300));
+    EXPECT_TRUE(script[2].event.is<sf::Event::MouseMoved>());
+}
+
+TEST(headlessRunnerTest, runsFixedTicks) {
+    HeadlessOptions options;
+    options.ticks = 50;
+    options.useRenderTexture = false;
+    HeadlessRunner runner(options);
+    runner.getSceneManager().registerScene<CountingScene>("Counting");
+    runner.getSceneManager().changeScene("Counting");
+
+    HeadlessReport report = runner.run({});
+    const auto *scene =
+        static_cast<const CountingScene *>(runner.getSceneManager().getCurrentScene());
+    EXPECT_EQ(scene->updates, 50);
+    EXPECT_EQ(scene->subticks, 50 * GameConstants::SUBTICKS_PER_TICK);
+    EXPECT_EQ(report.ticks, 50u);
+    EXPECT_EQ(report.targetKind, "null");
+    std::uint32_t histogramTotal = 0;
+    for (auto count : report.histogram) histogramTotal += count;
+    EXPECT_EQ(histogramTotal, 50u);
+    EXPECT_LE(report.p50Milliseconds, report.p99Milliseconds);
+    EXPECT_LE(report.p99Milliseconds, report.maxMilliseconds);
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "Core/HeadlessRunner.hpp"
+#include "Core/InputRecorder.hpp"
+#include "Scene/BlankScene.hpp"
+
+namespace {
+/// Logs the tick each event arrives on.
+class EventLogScene : public BlankScene {
+   public:
+    std::uint32_t ticks = 0;
+    std::vector<std::pair<std::uint32_t, sf::Event>> events;
+    EventLogScene(sf::RenderTarget &target, const std::string &name) : BlankScene{target, name} {}
+    void handleEvent(std::optional<sf::Event> &event) override {
+        if (event) events.emplace_back(ticks, *event);
+    }
+    void update() override { ticks++; }
+};
+
+/// Spells out an event's type and fields, as sf::Event has no operator==.
+std::string describe(const sf::Event &event) {
+    std::ostringstream text;
+    text << event.visit([](const auto &variant) { return typeid(variant).name(); });
+    if (const auto *key = event.getIf<sf::Event::KeyPressed>())
+        text << static_cast<int>(key->code) << ' ' << static_cast<int>(key->scancode) << key->alt << key->control
+             << key->shift << key->system;
+    if (const auto *key = event.getIf<sf::Event::KeyReleased>())
+        text << static_cast<int>(key->code) << ' ' << static_cast<int>(key->scancode) << key->alt << key->control
+             << key->shift << key->system;
+    if (const auto *entered = event.getIf<sf::Event::TextEntered>()) text << static_cast<std::uint32_t>(entered->unicode);
+    if (const auto *resized = event.getIf<sf::Event::Resized>()) text << resized->size.x << 'x' << resized->size.y;
+    if (const auto *moved = event.getIf<sf::Event::MouseMoved>()) text << moved->position.x << ',' << moved->position.y;
+    if (const auto *button = event.getIf<sf::Event::MouseButtonPressed>())
+        text << static_cast<int>(button->button) << ' ' << button->position.x << ',' << button->position.y;
+    if (const auto *wheel = event.getIf<sf::Event::MouseWheelScrolled>())
+        text << static_cast<int>(wheel->wheel) << ' ' << wheel->delta << ' ' << wheel->position.x << ','
+             << wheel->position.y;
+    return text.str();
+}
+
+std::vector<ScriptedEvent> sampleSession() {
+    sf::Event::KeyPressed shiftA{sf::Keyboard::Key::A};
+    shiftA.scancode = sf::Keyboard::Scancode::A;
+    shiftA.shift = true;
+    return {{0, sf::Event::FocusGained{}},
+            {0, sf::Event::MouseMoved{{-5, 700}}},
+            {3, shiftA},
+            {3, sf::Event::TextEntered{U'é'}},
+            {9, sf::Event::MouseButtonPressed{sf::Mouse::Button::Right, {400, 300}}},
+            {9, sf::Event::MouseWheelScrolled{sf::Mouse::Wheel::Vertical, -1.5f, {10, 20}}},
+            {200, sf::Event::Resized{{1920, 1080}}},
+            {201, sf::Event::KeyReleased{sf::Keyboard::Key::A}}};
+}
+
+std::filesystem::path recordSample(const char *name, std::uint32_t ticks) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    InputRecorder recorder;
+    EXPECT_TRUE(recorder.open(path, 60));
+    for (const ScriptedEvent &scripted : sampleSession()) recorder.record(scripted.tick, scripted.event);
+    recorder.close(ticks);
+    EXPECT_EQ(recorder.getEventCount(), sampleSession().size());
+    EXPECT_EQ(recorder.getSkippedCount(), 0u);
+    return path;
+}
+}  // namespace
+
+TEST(inputRecorderTest, roundTrip) {
+    const auto path = recordSample("inputRecorderTest.inpr", 240);
+    auto recording = InputRecorder::load(path);
+    ASSERT_TRUE(recording.has_value());
+    EXPECT_EQ(recording->tickRate, 60u);
+    EXPECT_EQ(recording->ticks, 240u);
+    const auto expected = sampleSession();
+    ASSERT_EQ(recording->events.size(), expected.size());
+    for (std::size_t index = 0; index < expected.size(); index++) {
+        EXPECT_EQ(recording->events[index].tick, expected[index].tick);
+        EXPECT_EQ(describe(recording->events[index].event), describe(expected[index].event));
+    }
+    // A couple of bytes per event, not a struct dump
+    EXPECT_LT(std::filesystem::file_size(path), 8 + expected.size() * 12);
+    std::filesystem::remove(path);
+}
+
+TEST(inputRecorderTest, truncatedFileKeepsCompleteRecords) {
+    const auto path = recordSample("inputRecorderTest.cut", 240);
+    std::ifstream file(path, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::filesystem::remove(path);
+
+    // Drop the end record and half of the last event
+    std::istringstream cut(bytes.substr(0, bytes.size() - 5));
+    auto recording = InputRecorder::read(cut);
+    ASSERT_TRUE(recording.has_value());
+    ASSERT_EQ(recording->events.size(), sampleSession().size() - 1);
+    EXPECT_EQ(recording->ticks, 201u);
+
+    std::istringstream notRecording("RIFF\x01\x00<\x00");
+    EXPECT_FALSE(InputRecorder::read(notRecording).has_value());
+}
+
+TEST(inputRecorderTest, replaysOnTheRecordedTicks) {
+    const auto path = recordSample("inputRecorderTest.replay", 240);
+    auto recording = InputRecorder::load(path);
+    std::filesystem::remove(path);
+    ASSERT_TRUE(recording.has_value());
+
+    HeadlessOptions options;
+    options.ticks = recording->ticks;
+    options.render = false;
+    options.jobWorkers = 1;
+    HeadlessRunner runner(options);
+    runner.getSceneManager().registerScene<EventLogScene>("Log");
+    runner.getSceneManager().changeScene("Log");
+    EXPECT_EQ(runner.run(recording->events).ticks, 240u);
+
+    const auto *scene = static_cast<const EventLogScene *>(runner.getSceneManager().getCurrentScene());
+    const auto expected = sampleSession();
+    ASSERT_EQ(scene->events.size(), expected.size());
+    for (std::size_t index = 0; index < expected.size(); index++) {
+        EXPECT_EQ(scene->events[index].first, expected[index].tick);
+        EXPECT_EQ(describe(scene->events[index].second), describe(expected[index].event));
+    }
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+#include "Core/JobSystem.hpp"
+
+TEST(jobSystemTest, parallelForCoversTheRangeOnce) {
+    JobSystem jobs(3);
+    std::vector<int> visits(10000, 0);
+    jobs.parallelFor(0, visits.size(), 64, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; index++) visits[index]++;
+    });
+    for (int count : visits) ASSERT_EQ(count, 1);
+}
+
+TEST(jobSystemTest, runsEverythingWithoutWorkers) {
+    JobSystem jobs(0);
+    JobCounter counter;
+    std::atomic<int> sum{0};
+    for (int job = 1; job <= 100; job++) jobs.submit([&sum, job]() { sum += job; }, counter);
+    EXPECT_FALSE(counter.isDone());
+    jobs.wait(counter);
+    EXPECT_EQ(sum.load(), 5050);
+}
+
+TEST(jobSystemTest, jobsCanWaitOnNestedJobs) {
+    JobSystem jobs(2);
+    std::atomic<long> total{0};
+    jobs.parallelFor(0, 16, 1, [&](std::size_t, std::size_t) {
+        jobs.parallelFor(0, 1000, 10, [&](std::size_t begin, std::size_t end) {
+            long partial = 0;
+            for (std::size_t index = begin; index < end; index++) partial += static_cast<long>(index);
+            total += partial;
+        });
+    });
+    EXPECT_EQ(total.load(), 16 * 499500L);
+}
+
+TEST(jobSystemTest, taskGraphRespectsDependencies) {
+    JobSystem jobs(3);
+    std::atomic<int> step{0};
+    int movedAt = -1, indexedAt = -1, targetedAt = -1, resolvedAt = -1, effectsAt = -1;
+    TaskGraph graph;
+    auto movement = graph.add([&]() { movedAt = step++; });
+    auto index = graph.add([&]() { indexedAt = step++; });
+    auto targeting = graph.add([&]() { targetedAt = step++; });
+    auto effects = graph.add([&]() { effectsAt = step++; });
+    auto resolution = graph.add([&]() { resolvedAt = step++; });
+    graph.precede(movement, index);
+    graph.precede(index, targeting);
+    graph.precede(targeting, resolution);
+    graph.precede(movement, effects);
+    graph.precede(effects, resolution);
+    for (int tick = 0; tick < 50; tick++) {
+        step = 0;
+        graph.run(jobs);
+        ASSERT_EQ(step.load(), 5);
+        EXPECT_LT(movedAt, indexedAt);
+        EXPECT_LT(indexedAt, targetedAt);
+        EXPECT_LT(targetedAt, resolvedAt);
+        EXPECT_LT(effectsAt, resolvedAt);
+        EXPECT_LT(movedAt, effectsAt);
+    }
+}
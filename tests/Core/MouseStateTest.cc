@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <vector>
+
+#include "Core/MouseObserver.hpp"
+#include "Core/MouseState.hpp"
+#include "Core/NullRenderTarget.hpp"
+
+namespace {
+class RecordingObserver : public MouseObserver {
+   public:
+    std::vector<int> &log;
+    int id;
+    bool consume;
+    RecordingObserver(std::vector<int> &log, int id, bool consume = true)
+        : log{log}, id{id}, consume{consume} {}
+    void onMouseEvent(Mouse, UserEvent, const sf::Vector2f &, const sf::Vector2i &) override {
+        log.push_back(id);
+    }
+    bool onMouseHit(Mouse button, UserEvent event, const sf::Vector2f &world,
+                    const sf::Vector2i &window) override {
+        onMouseEvent(button, event, world, window);
+        return consume;
+    }
+};
+
+std::optional<sf::Event> leftPress(int x, int y) {
+    return sf::Event{sf::Event::MouseButtonPressed{sf::Mouse::Button::Left, {x, y}}};
+}
+}  // namespace
+
+TEST(mouseStateTest, topmostRegionConsumes) {
+    NullRenderTarget target({800, 600});
+    MouseState mouseState(target);
+    std::vector<int> log;
+    RecordingObserver background(log, 0), lower(log, 1), upper(log, 2);
+    background.subscribeMouse(Mouse::Left, UserEvent::Press, mouseState);
+    lower.subscribeMouse(Mouse::Left, UserEvent::Press, mouseState,
+                         {{{0.f, 0.f}, {100.f, 100.f}}, MouseSpace::Screen, 1});
+    upper.subscribeMouse(Mouse::Left, UserEvent::Press, mouseState,
+                         {{{50.f, 50.f}, {100.f, 100.f}}, MouseSpace::Screen, 2});
+
+    mouseState.handleEvent(leftPress(60, 60));
+    EXPECT_EQ(log, (std::vector<int>{2}));
+    log.clear();
+    mouseState.handleEvent(leftPress(10, 10));
+    EXPECT_EQ(log, (std::vector<int>{1}));
+    log.clear();
+    mouseState.handleEvent(leftPress(400, 400));
+    EXPECT_EQ(log, (std::vector<int>{0}));
+}
+
+TEST(mouseStateTest, passThroughAndMovedRegions) {
+    NullRenderTarget target({800, 600});
+    MouseState mouseState(target);
+    std::vector<int> log;
+    RecordingObserver background(log, 0), tooltip(log, 1, false);
+    background.subscribeMouse(Mouse::Left, UserEvent::Press, mouseState);
+    SubscriptionHandle handle = tooltip.subscribeMouse(
+        Mouse::Left, UserEvent::Press, mouseState, {{{0.f, 0.f}, {10.f, 10.f}}});
+
+    mouseState.handleEvent(leftPress(5, 5));
+    EXPECT_EQ(log, (std::vector<int>{1, 0}));
+    log.clear();
+    mouseState.setSubscriberBounds(handle, {{200.f, 200.f}, {10.f, 10.f}});
+    mouseState.handleEvent(leftPress(5, 5));
+    EXPECT_EQ(log, (std::vector<int>{0}));
+    log.clear();
+    mouseState.removeSubscriber(handle);
+    mouseState.handleEvent(leftPress(205, 205));
+    EXPECT_EQ(log, (std::vector<int>{0}));
+}
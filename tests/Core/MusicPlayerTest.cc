@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "Core/AssetPack.hpp"
+#include "Core/MusicPlayer.hpp"
+#include "Core/MusicStream.hpp"
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+namespace {
+constexpr unsigned SAMPLE_RATE = 22050;
+constexpr unsigned CHANNELS = 2;
+constexpr unsigned TRACK_SECONDS = 180;
+
+/**
+ * @brief Exposes the pull side of the stream, so the test can decode without an audio device.
+ */
+class DecodingStream : public MusicStream {
+   public:
+    using MusicStream::MusicStream;
+    using MusicStream::onGetData;
+};
+
+/**
+ * @brief Writes a long stereo sine-ish track one second at a time.
+ */
+std::filesystem::path writeLongTrack() {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "musicPlayerTest.wav";
+    sf::OutputSoundFile file;
+    if (!file.openFromFile(path, SAMPLE_RATE, CHANNELS, {sf::SoundChannel::FrontLeft, sf::SoundChannel::FrontRight}))
+        return {};
+    std::vector<std::int16_t> second(SAMPLE_RATE * CHANNELS);
+    for (unsigned index = 0; index < TRACK_SECONDS; index++) {
+        for (std::size_t sample = 0; sample < second.size(); sample++)
+            second[sample] = static_cast<std::int16_t>((sample * 37 + index) % 2000 - 1000);
+        file.write(second.data(), second.size());
+    }
+    file.close();
+    return path;
+}
+
+/**
+ * @brief Gets the resident set size of the process, or 0 where it is not available.
+ */
+std::size_t residentBytes() {
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    std::size_t total = 0, resident = 0;
+    if (statm >> total >> resident) return resident * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    return 0;
+}
+}  // namespace
+
+TEST(musicPlayerTest, longTrackDecodesInConstantMemory) {
+    const std::filesystem::path path = writeLongTrack();
+    ASSERT_FALSE(path.empty());
+
+    DecodingStream stream(64 * 1024);
+    ASSERT_TRUE(stream.openFromFile(path));
+    const std::size_t bufferBytes = stream.getBufferBytes();
+    EXPECT_LE(bufferBytes, 64u * 1024);
+
+    // Warm up, then decode the rest of the track, about 16 MB of samples
+    sf::SoundStream::Chunk chunk;
+    for (int warmup = 0; warmup < 8; warmup++) ASSERT_TRUE(stream.onGetData(chunk));
+    const std::size_t residentBefore = residentBytes();
+    while (stream.onGetData(chunk)) {
+    }
+    const std::size_t residentAfter = residentBytes();
+
+    EXPECT_EQ(stream.getSamplesDecoded(), std::uint64_t{SAMPLE_RATE} * CHANNELS * TRACK_SECONDS);
+    EXPECT_EQ(stream.getBufferBytes(), bufferBytes);
+    if (residentBefore != 0) EXPECT_LT(residentAfter, residentBefore + 1024 * 1024);
+    std::filesystem::remove(path);
+}
+
+TEST(musicPlayerTest, splitsTheMemoryCapBetweenStreams) {
+    AssetPack pack;
+    MusicPlayer player(pack, {128 * 1024});
+    EXPECT_LE(player.getBufferBytes(), 128u * 1024);
+    EXPECT_TRUE(player.getCurrentTrack().empty());
+    EXPECT_FALSE(player.play("assets/music/missing.ogg"));
+    EXPECT_TRUE(player.getCurrentTrack().empty());
+}
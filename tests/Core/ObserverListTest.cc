@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Core/ObserverList.hpp"
+
+namespace {
+struct Counter {
+    int calls = 0;
+};
+}  // namespace
+
+TEST(observerListTest, handleRemoval) {
+    ObserverList<Counter> list;
+    Counter first, second, third;
+    list.add(&first);
+    SubscriptionHandle handle = list.add(&second);
+    list.add(&third);
+    EXPECT_TRUE(list.remove(handle));
+    EXPECT_FALSE(list.remove(handle));
+    list.forEach([](Counter *counter) { counter->calls++; });
+    EXPECT_EQ(first.calls, 1);
+    EXPECT_EQ(second.calls, 0);
+    EXPECT_EQ(third.calls, 1);
+}
+
+TEST(observerListTest, staleHandleAfterSlotReuse) {
+    ObserverList<Counter> list;
+    Counter first, second;
+    SubscriptionHandle stale = list.add(&first);
+    list.remove(stale);
+    list.add(&second);
+    EXPECT_FALSE(list.remove(stale));
+    EXPECT_TRUE(list.contains(&second));
+}
+
+TEST(observerListTest, modifyDuringDispatch) {
+    ObserverList<Counter> list;
+    Counter first, second, added;
+    list.add(&first);
+    SubscriptionHandle secondHandle = list.add(&second);
+    list.forEach([&](Counter *counter) {
+        counter->calls++;
+        if (counter == &first) {
+            list.remove(secondHandle);
+            list.add(&added);
+        }
+    });
+    EXPECT_EQ(first.calls, 1);
+    EXPECT_EQ(second.calls, 0);
+    EXPECT_EQ(added.calls, 0);
+    list.forEach([](Counter *counter) { counter->calls++; });
+    EXPECT_EQ(added.calls, 1);
+    EXPECT_EQ(list.size(), 2u);
+}
+
+TEST(observerListTest, removeSelfDuringDispatch) {
+    ObserverList<Counter> list;
+    Counter first, second;
+    list.add(&first);
+    list.add(&second);
+    list.forEach([&](Counter *counter) {
+        counter->calls++;
+        list.remove(counter);
+    });
+    EXPECT_EQ(first.calls, 1);
+    EXPECT_EQ(second.calls, 1);
+    EXPECT_TRUE(list.empty());
+}
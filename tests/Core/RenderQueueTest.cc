@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include "Core/EntityStore.hpp"
+#include "Core/NullRenderTarget.hpp"
+#include "Core/RenderQueue.hpp"
+#include "Core/ResourceManager.hpp"
+
+TEST(renderQueueTest, mergesQuadsSharingATexture) {
+    ResourceManager resources;
+    NullRenderTarget target({64, 64});
+    RenderQueue queue(resources);
+    for (int i = 0; i < 100; i++)
+        queue.submit(TextureHandle{}, sf::Vector2f(i, i), sf::IntRect({0, 0}, {4, 4}), sf::Color::Red,
+                     static_cast<std::int16_t>(i % 3));
+    EXPECT_EQ(queue.size(), 100u);
+    queue.flush(target);
+    EXPECT_EQ(queue.getStats().quads, 100u);
+    EXPECT_EQ(queue.getStats().drawCalls, 1u);
+    EXPECT_EQ(queue.getStats().vertices, 600u);
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(renderQueueTest, skipsUnloadedTextures) {
+    ResourceManager resources;
+    NullRenderTarget target({64, 64});
+    RenderQueue queue(resources);
+    queue.submit(TextureHandle{0, 0}, sf::Transform::Identity, sf::IntRect({0, 0}, {4, 4}));
+    queue.submit(TextureHandle{}, sf::Vector2f(), sf::IntRect({0, 0}, {4, 4}), sf::Color::White, 1);
+    queue.flush(target);
+    EXPECT_EQ(queue.getStats().skippedQuads, 1u);
+    EXPECT_EQ(queue.getStats().drawCalls, 1u);
+}
+
+TEST(renderQueueTest, submitsSpriteEntities) {
+    ResourceManager resources;
+    NullRenderTarget target({64, 64});
+    RenderQueue queue(resources);
+    EntityStore entities;
+    entities.create(Component::Position | Component::Sprite);
+    entities.create(Component::Position | Component::Sprite);
+    entities.create(Component::Position);
+    queue.submit(entities, 1.f);
+    EXPECT_EQ(queue.size(), 2u);
+    queue.clear();
+    queue.flush(target);
+    EXPECT_EQ(queue.getStats().drawCalls, 0u);
+}
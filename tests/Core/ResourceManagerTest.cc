@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Core/ResourceManager.hpp"
+
+namespace {
+constexpr unsigned SAMPLE_RATE = 22050;
+
+/// Writes a half-second mono clip.
+std::filesystem::path writeClip(const std::string &name) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    sf::OutputSoundFile file;
+    if (!file.openFromFile(path, SAMPLE_RATE, 1, {sf::SoundChannel::Mono})) return {};
+    std::vector<std::int16_t> samples(SAMPLE_RATE / 2, 0);
+    file.write(samples.data(), samples.size());
+    file.close();
+    return path;
+}
+}  // namespace
+
+TEST(resourceManagerTest, asyncLoadsFinishWithinTheUploadBudget) {
+    constexpr int CLIPS = 4;
+    std::vector<std::filesystem::path> clips;
+    for (int index = 0; index < CLIPS; index++) {
+        clips.push_back(writeClip("resourceManagerTest" + std::to_string(index) + ".wav"));
+        ASSERT_FALSE(clips.back().empty());
+    }
+
+    ResourceManager resources;
+    std::vector<std::future<bool>> loads;
+    for (int index = 0; index < CLIPS; index++)
+        loads.push_back(resources.loadSoundAsync(clips[index].string(), "clip" + std::to_string(index)));
+    const std::filesystem::path missingPath = std::filesystem::temp_directory_path() / "resourceManagerTestMissing.wav";
+    std::filesystem::remove(missingPath);
+    std::future<bool> missing = resources.loadSoundAsync(missingPath.string(), "missing");
+    // Taken by a load still in flight: refused at once and not part of the batch
+    std::future<bool> collision = resources.loadSoundAsync(clips[0].string(), "clip0");
+    ASSERT_EQ(collision.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_FALSE(collision.get());
+
+    const LoadProgress &progress = resources.getLoadProgress();
+    EXPECT_EQ(progress.requested, CLIPS + 1u);
+    EXPECT_EQ(progress.finished, 0u);
+    EXPECT_FALSE(progress.isDone());
+
+    // A zero budget hands over one decoded asset per call
+    float fraction = progress.getFraction();
+    while (!progress.isDone()) {
+        const std::size_t before = progress.finished;
+        const std::size_t finished = resources.finishUploads(sf::Time::Zero);
+        EXPECT_LE(finished, 1u);
+        EXPECT_EQ(progress.finished, before + finished);
+        EXPECT_GE(progress.getFraction(), fraction);
+        fraction = progress.getFraction();
+        if (finished == 0) std::this_thread::yield();
+    }
+    EXPECT_EQ(progress.finished, CLIPS + 1u);
+    EXPECT_EQ(progress.failed, 1u);
+    EXPECT_FLOAT_EQ(progress.getFraction(), 1.f);
+
+    for (int index = 0; index < CLIPS; index++) {
+        EXPECT_TRUE(loads[index].get());
+        SoundHandle sound = resources.getSoundHandle(StringId::hash("clip" + std::to_string(index)));
+        ASSERT_TRUE(sound.isValid());
+        EXPECT_EQ(resources.getMemoryUsage(sound), SAMPLE_RATE / 2 * sizeof(std::int16_t));
+    }
+    EXPECT_FALSE(missing.get());
+    EXPECT_FALSE(resources.getSoundHandle("missing"_sid).isValid());
+
+    // Loaded IDs collide too, and the finished batch stays as it was
+    std::future<bool> reload = resources.loadSoundAsync(clips[1].string(), "clip1");
+    ASSERT_EQ(reload.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_FALSE(reload.get());
+    EXPECT_EQ(progress.requested, CLIPS + 1u);
+
+    // The next request starts a new batch
+    std::future<bool> next = resources.loadSoundAsync(clips[1].string(), "again");
+    EXPECT_EQ(progress.requested, 1u);
+    EXPECT_EQ(progress.finished, 0u);
+    while (!progress.isDone()) resources.finishUploads(sf::milliseconds(1));
+    EXPECT_TRUE(next.get());
+    EXPECT_EQ(progress.failed, 0u);
+
+    for (const auto &clip : clips) std::filesystem::remove(clip);
+}
+
+TEST(resourceManagerTest, drawingContinuesWhileTheOwnerWorks) {
+    const std::filesystem::path image = std::filesystem::temp_directory_path() / "resourceManagerTestPage.png";
+    ASSERT_TRUE(sf::Image({4, 4}, sf::Color::Red).saveToFile(image));
+    ResourceManager resources;
+    std::shared_mutex drawMutex;
+    resources.setDrawMutex(&drawMutex);
+    const TextureHandle page = resources.loadTexture(image.string(), "page");
+    if (!page.isValid()) GTEST_SKIP() << "No textures without a graphics context";
+
+    // A render thread drawing from the textures, as Application's does
+    std::atomic<bool> done{false};
+    std::atomic<int> frames{0};
+    std::thread render([&] {
+        while (!done) {
+            {
+                std::shared_lock<std::shared_mutex> lock(drawMutex);
+                if (resources.getTexture(page) != nullptr) frames++;
+            }
+            // Stands in for display(), which runs unlocked
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    // A slow tick holds no lock, so frames keep coming while it runs
+    const int before = frames;
+    const TextureHandle scratch = resources.loadTexture(image.string(), "scratch");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    resources.unloadTexture(scratch);
+    EXPECT_GT(frames - before, 10);
+    EXPECT_EQ(resources.getTexture(scratch), nullptr);
+
+    // Changes to the maps themselves wait for the frame being drawn
+    std::shared_lock<std::shared_mutex> drawing(drawMutex);
+    std::future<void> unload = std::async(std::launch::async, [&] { resources.unloadTexture(page); });
+    EXPECT_EQ(unload.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+    EXPECT_NE(resources.getTexture(page), nullptr);
+    drawing.unlock();
+    unload.get();
+    EXPECT_EQ(resources.getTexture(page), nullptr);
+
+    done = true;
+    render.join();
+    resources.setDrawMutex(nullptr);
+    std::filesystem::remove(image);
+}
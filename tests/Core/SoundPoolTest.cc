@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "Core/SoundPool.hpp"
+
+namespace {
+constexpr unsigned SAMPLE_RATE = 8000;
+
+/**
+ * @brief Ten seconds of silence: long enough to still be playing when checked, inaudible if a device is there.
+ */
+const sf::SoundBuffer &silence() {
+    static sf::SoundBuffer buffer;
+    static const bool loaded = [] {
+        std::vector<std::int16_t> samples(SAMPLE_RATE * 10, 0);
+        return buffer.loadFromSamples(samples.data(), samples.size(), 1, SAMPLE_RATE, {sf::SoundChannel::Mono});
+    }();
+    EXPECT_TRUE(loaded);
+    return buffer;
+}
+
+/**
+ * @brief Checks whether sounds keep playing here; without an audio device they stop at once.
+ */
+bool canPlay() {
+    SoundPool pool({1, VoiceStealPolicy::None});
+    return pool.isPlaying(pool.play("probe"_sid, silence()));
+}
+}  // namespace
+
+TEST(soundPoolTest, oldestPolicyStealsTheFirstStarted) {
+    if (!canPlay()) GTEST_SKIP() << "No audio playback";
+    SoundPool pool({3, VoiceStealPolicy::Oldest});
+    VoiceHandle first = pool.play("a"_sid, silence());
+    VoiceHandle second = pool.play("b"_sid, silence());
+    VoiceHandle third = pool.play("c"_sid, silence());
+    EXPECT_EQ(pool.getActiveCount(), 3u);
+
+    VoiceHandle fourth = pool.play("d"_sid, silence());
+    ASSERT_TRUE(fourth.isValid());
+    EXPECT_FALSE(pool.isPlaying(first));
+    EXPECT_TRUE(pool.isPlaying(second));
+    EXPECT_TRUE(pool.isPlaying(third));
+    EXPECT_TRUE(pool.isPlaying(fourth));
+    EXPECT_EQ(pool.getStolenCount(), 1u);
+    // The stolen handle stays stale even though its voice plays again
+    EXPECT_EQ(fourth.voice, first.voice);
+    pool.stop(first);
+    EXPECT_TRUE(pool.isPlaying(fourth));
+}
+
+TEST(soundPoolTest, lowestPriorityNeverStealsAboveTheNewSound) {
+    if (!canPlay()) GTEST_SKIP() << "No audio playback";
+    SoundPool pool({2, VoiceStealPolicy::LowestPriority});
+    VoiceHandle music = pool.play("music"_sid, silence(), {100.f, 1.f, 5});
+    VoiceHandle step = pool.play("step"_sid, silence(), {100.f, 1.f, 1});
+
+    EXPECT_FALSE(pool.play("ambient"_sid, silence(), {100.f, 1.f, 0}).isValid());
+    EXPECT_EQ(pool.getDroppedCount(), 1u);
+
+    VoiceHandle alarm = pool.play("alarm"_sid, silence(), {100.f, 1.f, 3});
+    ASSERT_TRUE(alarm.isValid());
+    EXPECT_FALSE(pool.isPlaying(step));
+    EXPECT_TRUE(pool.isPlaying(music));
+    EXPECT_EQ(pool.getStolenCount(), 1u);
+}
+
+TEST(soundPoolTest, nonePolicyDropsWhenFull) {
+    if (!canPlay()) GTEST_SKIP() << "No audio playback";
+    SoundPool pool({2, VoiceStealPolicy::None});
+    VoiceHandle first = pool.play("a"_sid, silence());
+    VoiceHandle second = pool.play("b"_sid, silence());
+    EXPECT_FALSE(pool.play("c"_sid, silence()).isValid());
+    EXPECT_TRUE(pool.isPlaying(first));
+    EXPECT_TRUE(pool.isPlaying(second));
+    EXPECT_EQ(pool.getDroppedCount(), 1u);
+    EXPECT_EQ(pool.getStolenCount(), 0u);
+}
+
+TEST(soundPoolTest, voiceLimitStealsWithinTheSameID) {
+    if (!canPlay()) GTEST_SKIP() << "No audio playback";
+    SoundPool pool({8, VoiceStealPolicy::Oldest});
+    pool.setVoiceLimit("shot"_sid, 2);
+    VoiceHandle older = pool.play("explosion"_sid, silence());
+    VoiceHandle first = pool.play("shot"_sid, silence());
+    VoiceHandle second = pool.play("shot"_sid, silence());
+    VoiceHandle third = pool.play("shot"_sid, silence());
+
+    // Free voices are left alone: the cap makes the oldest shot give way, not the explosion
+    EXPECT_EQ(pool.getActiveCount(), 3u);
+    EXPECT_TRUE(pool.isPlaying(older));
+    EXPECT_FALSE(pool.isPlaying(first));
+    EXPECT_TRUE(pool.isPlaying(second));
+    EXPECT_TRUE(pool.isPlaying(third));
+    EXPECT_EQ(pool.getStolenCount(), 1u);
+
+    pool.stopAll("shot"_sid);
+    EXPECT_EQ(pool.getActiveCount(), 1u);
+    EXPECT_TRUE(pool.isPlaying(older));
+}
+
+TEST(soundPoolTest, updateReclaimsFinishedVoices) {
+    // An empty buffer finishes as soon as it starts, with or without a device
+    const sf::SoundBuffer empty;
+    SoundPool pool({3, VoiceStealPolicy::Oldest});
+    for (int index = 0; index < 3; index++) EXPECT_TRUE(pool.play("blip"_sid, empty).isValid());
+    EXPECT_EQ(pool.getActiveCount(), 3u);
+    pool.update();
+    EXPECT_EQ(pool.getActiveCount(), 0u);
+
+    // A full pool also reclaims finished voices before it steals one
+    for (int index = 0; index < 4; index++) pool.play("blip"_sid, empty);
+    EXPECT_EQ(pool.getStolenCount(), 0u);
+    EXPECT_EQ(pool.getDroppedCount(), 0u);
+}
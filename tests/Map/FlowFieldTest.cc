@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "Map/FlowField.hpp"
+
+namespace {
+const sf::Vector2i SIZE{24, 18};
+
+/**
+ * @brief Checks that two snapshots agree on every distance.
+ */
+void expectSameDistances(const FlowFieldSnapshot &actual, const FlowFieldSnapshot &expected) {
+    ASSERT_EQ(actual.distance.size(), expected.distance.size());
+    for (std::size_t cell = 0; cell < actual.distance.size(); cell++)
+        ASSERT_EQ(actual.distance[cell], expected.distance[cell]) << "cell " << cell;
+}
+}  // namespace
+
+TEST(flowFieldTest, pointsTowardsTheGoal) {
+    MapGrid grid(SIZE);
+    FlowField field(grid, {{0, 0}}, false);
+    auto snapshot = field.getSnapshot();
+    EXPECT_EQ(snapshot->getDistance({0, 0}), 0u);
+    EXPECT_EQ(snapshot->getDistance({3, 0}), 30u);
+    EXPECT_EQ(snapshot->getDistance({2, 2}), 28u);
+    EXPECT_EQ(snapshot->getDirection({3, 0}), (sf::Vector2f{-1.f, 0.f}));
+    EXPECT_EQ(snapshot->getDirection({0, 0}), (sf::Vector2f{}));
+    EXPECT_EQ(snapshot->getDirectionAt(grid.cellToWorld({0, 5})), (sf::Vector2f{0.f, -1.f}));
+}
+
+TEST(flowFieldTest, wallCutsOffTheFarSide) {
+    MapGrid grid(SIZE);
+    FlowField field(grid, {{0, 0}}, false);
+    for (int y = 0; y < SIZE.y; y++) field.setCost({10, y}, MapGrid::BLOCKED);
+    auto snapshot = field.getSnapshot();
+    EXPECT_EQ(snapshot->getDistance({15, 5}), FlowFieldSnapshot::UNREACHABLE);
+    EXPECT_EQ(snapshot->getDirection({15, 5}), (sf::Vector2f{}));
+    EXPECT_NE(snapshot->getDistance({5, 5}), FlowFieldSnapshot::UNREACHABLE);
+
+    field.setCost({10, 9}, 1);
+    snapshot = field.getSnapshot();
+    EXPECT_NE(snapshot->getDistance({15, 5}), FlowFieldSnapshot::UNREACHABLE);
+}
+
+TEST(flowFieldTest, incrementalRepairMatchesFullSolve) {
+    MapGrid grid(SIZE);
+    const std::vector<sf::Vector2i> goals{{0, 9}, {23, 0}};
+    FlowField field(grid, goals, false);
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> x(0, SIZE.x - 1), y(0, SIZE.y - 1), cost(1, 4);
+    for (int edit = 0; edit < 300; edit++) {
+        const sf::Vector2i cell{x(random), y(random)};
+        const std::uint8_t newCost = random() % 3 == 0 ? static_cast<std::uint8_t>(cost(random)) : MapGrid::BLOCKED;
+        const std::uint8_t applied = grid.isBlocked(cell) ? static_cast<std::uint8_t>(cost(random)) : newCost;
+        grid.setCost(cell, applied);
+        field.setCost(cell, applied);
+        FlowField fresh(grid, goals, false);
+        expectSameDistances(*field.getSnapshot(), *fresh.getSnapshot());
+    }
+}
+
+TEST(flowFieldTest, workerPublishesEdits) {
+    MapGrid grid(SIZE);
+    FlowField field(grid, {{0, 0}});
+    auto before = field.getSnapshot();
+    field.setCost({1, 0}, MapGrid::BLOCKED);
+    field.setCost({1, 1}, MapGrid::BLOCKED);
+    field.setCost({0, 1}, MapGrid::BLOCKED);
+    field.waitForUpdates();
+    auto after = field.getSnapshot();
+    EXPECT_GT(after->version, before->version);
+    EXPECT_EQ(after->getDistance({5, 5}), FlowFieldSnapshot::UNREACHABLE);
+    EXPECT_NE(before->getDistance({5, 5}), FlowFieldSnapshot::UNREACHABLE);
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <random>
+
+#include "Map/PlacementValidator.hpp"
+
+namespace {
+const sf::Vector2i SIZE{16, 12};
+
+/**
+ * @brief Checks by BFS whether every spawn that reaches a goal still does with one more tile blocked.
+ */
+bool bruteForceCanPlace(MapGrid grid, const std::vector<sf::Vector2i> &spawns,
+                        const std::vector<sf::Vector2i> &goals, sf::Vector2i cell) {
+    const auto reachable = [&](const MapGrid &map) {
+        std::vector<std::uint8_t> seen(map.getCosts().size(), 0);
+        std::deque<sf::Vector2i> queue;
+        for (sf::Vector2i goal : goals)
+            if (!map.isBlocked(goal)) {
+                seen[map.index(goal)] = 1;
+                queue.push_back(goal);
+            }
+        while (!queue.empty()) {
+            sf::Vector2i current = queue.front();
+            queue.pop_front();
+            for (sf::Vector2i step : {sf::Vector2i{1, 0}, sf::Vector2i{-1, 0}, sf::Vector2i{0, 1}, sf::Vector2i{0, -1}}) {
+                sf::Vector2i next = current + step;
+                if (map.isBlocked(next) || seen[map.index(next)]) continue;
+                seen[map.index(next)] = 1;
+                queue.push_back(next);
+            }
+        }
+        return seen;
+    };
+    const std::vector<std::uint8_t> before = reachable(grid);
+    grid.setCost(cell, MapGrid::BLOCKED);
+    const std::vector<std::uint8_t> after = reachable(grid);
+    for (sf::Vector2i spawn : spawns)
+        if (before[grid.index(spawn)] && !after[grid.index(spawn)]) return false;
+    return true;
+}
+}  // namespace
+
+TEST(placementValidatorTest, refusesToSealACorridor) {
+    MapGrid grid(SIZE);
+    // A wall across the map with a single gap at (8, 6)
+    for (int y = 0; y < SIZE.y; y++)
+        if (y != 6) grid.setCost({8, y}, MapGrid::BLOCKED);
+    PlacementValidator validator(grid, {{0, 0}}, {{15, 11}});
+    EXPECT_TRUE(validator.isPathOpen());
+    EXPECT_FALSE(validator.canPlace({8, 6}));
+    EXPECT_FALSE(validator.canPlace({8, 0}));
+    EXPECT_FALSE(validator.canPlace({0, 0}));
+    EXPECT_FALSE(validator.canPlace({15, 11}));
+    EXPECT_FALSE(validator.canPlace({-1, 3}));
+    EXPECT_TRUE(validator.canPlace({4, 4}));
+
+    validator.setCost({8, 0}, 1);
+    EXPECT_TRUE(validator.canPlace({8, 6}));
+}
+
+TEST(placementValidatorTest, rebuildsOnlyAfterBlockingEdits) {
+    MapGrid grid(SIZE);
+    PlacementValidator validator(grid, {{0, 0}}, {{15, 11}});
+    for (int x = 0; x < SIZE.x; x++) validator.canPlace({x, 3});
+    EXPECT_EQ(validator.getRebuildCount(), 1u);
+    validator.setCost({2, 2}, 3);
+    validator.canPlace({4, 4});
+    EXPECT_EQ(validator.getRebuildCount(), 1u);
+    validator.setCost({2, 2}, MapGrid::BLOCKED);
+    validator.canPlace({4, 4});
+    EXPECT_EQ(validator.getRebuildCount(), 2u);
+}
+
+TEST(placementValidatorTest, matchesBruteForceOnRandomMaps) {
+    std::mt19937 random(11);
+    std::uniform_int_distribution<int> x(0, SIZE.x - 1), y(0, SIZE.y - 1);
+    const std::vector<sf::Vector2i> spawns{{0, 0}, {0, 11}};
+    const std::vector<sf::Vector2i> goals{{15, 5}, {15, 6}};
+    for (int map = 0; map < 20; map++) {
+        MapGrid grid(SIZE);
+        PlacementValidator validator(grid, spawns, goals);
+        for (int tower = 0; tower < 60; tower++) {
+            const sf::Vector2i cell{x(random), y(random)};
+            if (!validator.canPlace(cell)) continue;
+            grid.setCost(cell, MapGrid::BLOCKED);
+            validator.setCost(cell, MapGrid::BLOCKED);
+        }
+        ASSERT_TRUE(validator.isPathOpen());
+        for (int cellY = 0; cellY < SIZE.y; cellY++)
+            for (int cellX = 0; cellX < SIZE.x; cellX++) {
+                const sf::Vector2i cell{cellX, cellY};
+                if (grid.isBlocked(cell) || cell == spawns[0] || cell == spawns[1] || cell == goals[0] ||
+                    cell == goals[1])
+                    continue;
+                ASSERT_EQ(validator.canPlace(cell), bruteForceCanPlace(grid, spawns, goals, cell))
+                    << "map " << map << " cell " << cellX << "," << cellY;
+            }
+    }
+}
@@ -1,19 +1,29 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Core/NullRenderTarget.hpp"
+#include "Core/ResourceManager.hpp"
 #include "Core/SceneManager.hpp"
 #include "Scene/BlankScene.hpp"
 
 #include <SFML/Graphics.hpp>
 TEST(nullptrTest, null) {
-    sf::RenderWindow window;
-    SceneManager sceneManager(window);
+    NullRenderTarget target({1200, 800});
+    SceneManager sceneManager(target);
     auto currScene = sceneManager.getCurrentScene();
     EXPECT_EQ(currScene, nullptr);
 }
 
 TEST(nameTest, 1) {
-    sf::RenderWindow window;
-    SceneManager sceneManager(window);
+    NullRenderTarget target({1200, 800});
+    SceneManager sceneManager(target);
     sceneManager.registerScene<BlankScene>("Scene1");
     sceneManager.changeScene("Scene1");
     auto currScene = sceneManager.getCurrentScene();
@@ -22,8 +32,8 @@ TEST(nameTest, 1) {
     EXPECT_STREQ(sceneManager.getCurrentScene()->getName().c_str(), "Scene1");
 }
 TEST(nameTest, 2) {
-    sf::RenderWindow window;
-    SceneManager sceneManager(window);
+    NullRenderTarget target({1200, 800});
+    SceneManager sceneManager(target);
     sceneManager.registerScene<BlankScene>("Scene1");
     sceneManager.registerScene<BlankScene>("Scene2");
     sceneManager.changeScene("Scene1");
@@ -32,4 +42,359 @@ TEST(nameTest, 2) {
     EXPECT_NE(currScene, nullptr);
 
     EXPECT_STREQ(sceneManager.getCurrentScene()->getName().c_str(), "Scene2");
-}
\ No newline at end of file
+}
+
+namespace {
+/// Appends its lifecycle calls to a shared log and reports a fixed memory size.
+class LifecycleScene : public BlankScene {
+   public:
+    std::vector<std::string> &log;
+    std::size_t bytes;
+    LifecycleScene(sf::RenderTarget &target, const std::string &name, std::vector<std::string> &log,
+                   std::size_t bytes)
+        : BlankScene{target, name}, log{log}, bytes{bytes} {}
+    void onLoad() override { log.push_back("load " + name); }
+    void onEnter() override { log.push_back("enter " + name); }
+    void onExit() override { log.push_back("exit " + name); }
+    std::size_t getMemoryUsage() const override { return bytes; }
+    ~LifecycleScene() { log.push_back("destroy " + name); }
+};
+
+SceneManager::SceneFactory lifecycleFactory(std::vector<std::string> &log, std::atomic<int> &builds,
+                                            std::size_t bytes = 1000) {
+    return [&log, &builds, bytes](sf::RenderTarget &target, const std::string &name) {
+        builds++;
+        return std::make_unique<LifecycleScene>(target, name, log, bytes);
+    };
+}
+}  // namespace
+
+namespace {
+/// Loads one sound of its own when built.
+class AssetScene : public BlankScene {
+   public:
+    std::filesystem::path sound;
+    AssetScene(sf::RenderTarget &target, const std::string &name, std::filesystem::path sound)
+        : BlankScene{target, name}, sound{std::move(sound)} {}
+    void onLoad() override { loadSoundAsync(sound.string(), name + ".sound"); }
+};
+
+/// Writes a one second mono clip.
+std::filesystem::path writeClip() {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "sceneTest.wav";
+    sf::OutputSoundFile file;
+    if (!file.openFromFile(path, 22050, 1, {sf::SoundChannel::Mono})) return {};
+    std::vector<std::int16_t> samples(22050, 0);
+    file.write(samples.data(), samples.size());
+    file.close();
+    return path;
+}
+}  // namespace
+
+TEST(sceneLifecycleTest, buildsOnFirstEnter) {
+    std::vector<std::string> log;
+    std::atomic<int> builds = 0;
+    NullRenderTarget target({1200, 800});
+    SceneManager sceneManager(target);
+    sceneManager.registerScene("Menu", lifecycleFactory(log, builds));
+    sceneManager.registerScene("Game", lifecycleFactory(log, builds));
+    EXPECT_EQ(builds, 0);
+    EXPECT_FALSE(sceneManager.isLoaded("Game"));
+
+    sceneManager.changeScene("Menu");
+    sceneManager.changeScene("Game");
+    sceneManager.changeScene("Game");
+    sceneManager.changeScene("Menu");
+    EXPECT_EQ(builds, 2);
+    EXPECT_EQ(log, (std::vector<std::string>{"load Menu", "enter Menu", "load Game", "exit Menu", "enter Game",
+                                             "exit Game", "enter Menu"}));
+}
+
+TEST(sceneLifecycleTest, preloadBuildsInTheBackground) {
+    std::vector<std::string> log;
+    std::atomic<int> builds = 0;
+    NullRenderTarget target({1200, 800});
+    SceneManager sceneManager(target);
+    sceneManager.registerScene("Menu", lifecycleFactory(log, builds));
+    sceneManager.registerScene("Game", lifecycleFactory(log, builds));
+    sceneManager.changeScene("Menu");
+    EXPECT_TRUE(sceneManager.preload("Game"));
+    EXPECT_TRUE(sceneManager.preload("Game"));
+    EXPECT_FALSE(sceneManager.preload("Missing"));
+
+    // update() finishes the preload once the worker is done
+    while (!sceneManager.isLoaded("Game")) sceneManager.update();
+    EXPECT_EQ(log.back(), "load Game");
+    sceneManager.changeScene("Game");
+    EXPECT_EQ(builds, 2);
+    EXPECT_EQ(log.back(), "enter Game");
+
+    // changeScene() waits for a preload that is still running
+    sceneManager.registerScene("Shop", lifecycleFactory(log, builds));
+    sceneManager.preload("Shop");
+    sceneManager.changeScene("Shop");
+    EXPECT_EQ(builds, 3);
+    EXPECT_STREQ(sceneManager.getCurrentScene()->getName().c_str(), "Shop");
+}
+
+TEST(sceneLifecycleTest, evictsLeastRecentlyUsedOverBudget) {
+    std::vector<std::string> log;
+    std::atomic<int> builds = 0;
+    NullRenderTarget target({1200, 800});
+    SceneManager sceneManager(target);
+    sceneManager.setMemoryBudget(2500);
+    for (const char *name : {"A", "B", "C"}) sceneManager.registerScene(name, lifecycleFactory(log, builds));
+
+    sceneManager.changeScene("A");
+    sceneManager.changeScene("B");
+    EXPECT_EQ(sceneManager.getResidentMemory(), 2000u);
+    sceneManager.changeScene("C");
+    EXPECT_FALSE(sceneManager.isLoaded("A"));
+    EXPECT_TRUE(sceneManager.isLoaded("B"));
+    EXPECT_EQ(sceneManager.getEvictionCount(), 1u);
+    EXPECT_EQ(log.back(), "destroy A");
+
+    // Coming back rebuilds, and evicts the scene left longest ago
+    sceneManager.changeScene("A");
+    EXPECT_EQ(builds, 4);
+    EXPECT_FALSE(sceneManager.isLoaded("B"));
+    EXPECT_TRUE(sceneManager.isLoaded("C"));
+
+    // The current scene stays even when it alone exceeds the budget
+    sceneManager.setMemoryBudget(0);
+    EXPECT_TRUE(sceneManager.isLoaded("A"));
+    EXPECT_FALSE(sceneManager.isLoaded("C"));
+}
+
+namespace {
+/// Counts its updates and draws; flags are set per test.
+class LayerScene : public BlankScene {
+   public:
+    int updates = 0;
+    mutable int draws = 0;
+    LayerScene(sf::RenderTarget &target, const std::string &name, bool opaque, bool pausesBelow)
+        : BlankScene{target, name} {
+        this->opaque = opaque;
+        this->pausesBelow = pausesBelow;
+    }
+    void update() override { updates++; }
+    void draw(sf::RenderTarget &, sf::RenderStates) const override { draws++; }
+    void snapshot(RenderSnapshot &snapshot) const override {
+        snapshot.sprites.push_back({TextureHandle{}, {}, {0.f, 0.f}, {8.f, 0.f}, sf::Color::White, 0});
+    }
+};
+
+SceneManager::SceneFactory layerFactory(bool opaque, bool pausesBelow) {
+    return [opaque, pausesBelow](sf::RenderTarget &target, const std::string &name) {
+        return std::make_unique<LayerScene>(target, name, opaque, pausesBelow);
+    };
+}
+
+const LayerScene *currentLayer(SceneManager &sceneManager) {
+    return static_cast<const LayerScene *>(sceneManager.getCurrentScene());
+}
+}  // namespace
+
+TEST(sceneLifecycleTest, evictionLeavesAssetsOwnedElsewhere) {
+    const std::filesystem::path clip = writeClip();
+    ASSERT_FALSE(clip.empty());
+    ResourceManager resources;
+    NullRenderTarget target({1200, 800});
+    SceneManager sceneManager(target);
+    sceneManager.setContext({nullptr, nullptr, &resources});
+    sceneManager.registerScene("Level", [&clip](sf::RenderTarget &target, const std::string &name) {
+        return std::make_unique<AssetScene>(target, name, clip);
+    });
+    sceneManager.registerScene<BlankScene>("Menu");
+
+    // The game loaded the ID first, so the level's load is refused and the sound is not its own
+    resources.loadSoundAsync(clip.string(), "Level.sound");
+    while (!resources.getLoadProgress().isDone()) resources.finishUploads(sf::milliseconds(2));
+    sceneManager.changeScene("Level");
+    sceneManager.setMemoryBudget(1);
+    sceneManager.changeScene("Menu");
+    EXPECT_FALSE(sceneManager.isLoaded("Level"));
+    EXPECT_TRUE(resources.getSoundHandle(StringId::hash("Level.sound")).isValid());
+    std::filesystem::remove(clip);
+}
+
+TEST(sceneLifecycleTest, evictionCancelsLoadsInFlight) {
+    const std::filesystem::path clip = writeClip();
+    ASSERT_FALSE(clip.empty());
+    ResourceManager resources;
+    NullRenderTarget target({1200, 800});
+    SceneManager sceneManager(target);
+    sceneManager.setContext({nullptr, nullptr, &resources});
+    sceneManager.registerScene("Level", [&clip](sf::RenderTarget &target, const std::string &name) {
+        return std::make_unique<AssetScene>(target, name, clip);
+    });
+    sceneManager.registerScene<BlankScene>("Menu");
+
+    // Nothing is uploaded yet, but the queued sound already counts
+    sceneManager.changeScene("Level");
+    ASSERT_FALSE(resources.getLoadProgress().isDone());
+    const std::size_t clipBytes = std::filesystem::file_size(clip);
+    EXPECT_GT(sceneManager.getResidentMemory(), clipBytes);
+
+    sceneManager.setMemoryBudget(clipBytes);
+    sceneManager.changeScene("Menu");
+    EXPECT_FALSE(sceneManager.isLoaded("Level"));
+    EXPECT_FALSE(resources.isKnownID(ResourceManager::AssetKind::Sound, "Level.sound"));
+
+    // The decode still lands, and is dropped instead of staying resident without an owner
+    while (!resources.getLoadProgress().isDone()) resources.finishUploads(sf::milliseconds(2));
+    EXPECT_FALSE(resources.getSoundHandle(StringId::hash("Level.sound")).isValid());
+    EXPECT_EQ(resources.getLoadProgress().failed, 0u);
+    std::filesystem::remove(clip);
+}
+
+TEST(sceneStackTest, overlaysPauseAndHideWhatIsBelow) {
+    NullRenderTarget target({1200, 800});
+    SceneManager sceneManager(target);
+    sceneManager.registerScene("Battle", layerFactory(true, true));
+    sceneManager.registerScene("Pause", layerFactory(false, true));
+    sceneManager.registerScene("Hud", layerFactory(false, false));
+    sceneManager.registerScene("Shop", layerFactory(true, true));
+
+    sceneManager.changeScene("Battle");
+    const LayerScene *battle = currentLayer(sceneManager);
+    sceneManager.pushScene("Hud");
+    const LayerScene *hud = currentLayer(sceneManager);
+    sceneManager.update();
+    sceneManager.render(0.5f);
+    EXPECT_EQ(battle->updates, 1);
+    EXPECT_EQ(battle->draws, 1);
+    EXPECT_EQ(hud->draws, 1);
+
+    // A translucent pause menu freezes everything below but still shows it
+    sceneManager.pushScene("Pause");
+    EXPECT_EQ(sceneManager.getStackSize(), 3u);
+    sceneManager.update();
+    sceneManager.render(0.5f);
+    EXPECT_EQ(battle->updates, 1);
+    EXPECT_EQ(hud->updates, 1);
+    EXPECT_EQ(battle->draws, 2); // Drawn live: the null target has no render textures to cache into
+
+    RenderSnapshot snapshot;
+    sceneManager.snapshot(snapshot);
+    ASSERT_EQ(snapshot.sprites.size(), 3u);
+    EXPECT_EQ(snapshot.sprites[0].previous, snapshot.sprites[0].current);
+    EXPECT_NE(snapshot.sprites[2].previous, snapshot.sprites[2].current);
+
+    // An opaque scene on top hides everything
+    sceneManager.pushScene("Shop");
+    sceneManager.render(0.5f);
+    EXPECT_EQ(battle->draws, 2);
+    EXPECT_EQ(hud->draws, 2);
+
+    sceneManager.popScene();
+    sceneManager.popScene();
+    sceneManager.update();
+    EXPECT_EQ(battle->updates, 2);
+    EXPECT_STREQ(sceneManager.getCurrentScene()->getName().c_str(), "Hud");
+
+    sceneManager.pushScene("Hud");
+    EXPECT_EQ(sceneManager.getStackSize(), 2u);
+    sceneManager.changeScene("Battle");
+    EXPECT_EQ(sceneManager.getStackSize(), 1u);
+    EXPECT_EQ(sceneManager.getCurrentScene(), battle);
+    sceneManager.popScene();
+    EXPECT_EQ(sceneManager.getCurrentScene(), nullptr);
+}
+
+namespace {
+/// Fills rectangles of the target with fixed colours.
+class FillScene : public BlankScene {
+   public:
+    std::vector<std::pair<sf::FloatRect, sf::Color>> fills;
+    FillScene(sf::RenderTarget &target, const std::string &name, bool opaque, bool pausesBelow)
+        : BlankScene{target, name} {
+        this->opaque = opaque;
+        this->pausesBelow = pausesBelow;
+    }
+    void draw(sf::RenderTarget &target, sf::RenderStates states) const override {
+        for (const auto &[area, color] : fills) {
+            sf::RectangleShape shape(area.size);
+            shape.setPosition(area.position);
+            shape.setFillColor(color);
+            target.draw(shape, states);
+        }
+    }
+};
+
+/// Whether every channel of two pixels differs by at most one step of rounding.
+bool nearlyEqual(sf::Color a, sf::Color b) {
+    auto near = [](int x, int y) { return x - y <= 1 && y - x <= 1; };
+    return near(a.r, b.r) && near(a.g, b.g) && near(a.b, b.b) && near(a.a, b.a);
+}
+}  // namespace
+
+TEST(sceneStackTest, cachedLayersLookLikeLiveOnes) {
+    sf::RenderTexture target;
+    if (!target.resize({64, 64})) GTEST_SKIP() << "No render textures on this machine";
+    SceneManager sceneManager(target);
+    sceneManager.registerScene("Backdrop", [](sf::RenderTarget &target, const std::string &name) {
+        auto scene = std::make_unique<FillScene>(target, name, true, false);
+        scene->fills = {{{{0.f, 0.f}, {64.f, 64.f}}, sf::Color(40, 80, 120)}};
+        return scene;
+    });
+    // Overlapping translucent fills, so the cache has to accumulate alpha as the target would
+    sceneManager.registerScene("Tint", [](sf::RenderTarget &target, const std::string &name) {
+        auto scene = std::make_unique<FillScene>(target, name, false, false);
+        scene->fills = {{{{0.f, 0.f}, {32.f, 64.f}}, sf::Color(255, 0, 0, 128)},
+                        {{{16.f, 0.f}, {32.f, 64.f}}, sf::Color(0, 255, 0, 64)}};
+        return scene;
+    });
+    sceneManager.registerScene("Pause", [](sf::RenderTarget &target, const std::string &name) {
+        return std::make_unique<FillScene>(target, name, false, true);
+    });
+    sceneManager.changeScene("Backdrop");
+    sceneManager.pushScene("Tint");
+
+    auto frame = [&] {
+        target.clear();
+        sceneManager.render(1.f);
+        target.display();
+        return target.getTexture().copyToImage();
+    };
+    const sf::Image live = frame();
+
+    // A pausing scene that draws nothing leaves the layers below to be drawn from their caches
+    sceneManager.pushScene("Pause");
+    const sf::Image cached = frame();
+    for (unsigned x : {8u, 24u, 40u, 56u}) {
+        const sf::Color expected = live.getPixel({x, 32});
+        const sf::Color actual = cached.getPixel({x, 32});
+        EXPECT_TRUE(nearlyEqual(expected, actual))
+            << "x=" << x << ": live " << int(expected.r) << "," << int(expected.g) << "," << int(expected.b)
+            << " cached " << int(actual.r) << "," << int(actual.g) << "," << int(actual.b);
+    }
+}
+
+TEST(sceneLifecycleTest, evictionUnloadsOwnedAssets) {
+    const std::filesystem::path clip = writeClip();
+    ASSERT_FALSE(clip.empty());
+    ResourceManager resources;
+    NullRenderTarget target({1200, 800});
+    SceneManager sceneManager(target);
+    sceneManager.setContext({nullptr, nullptr, &resources});
+    sceneManager.registerScene("Level", [&clip](sf::RenderTarget &target, const std::string &name) {
+        return std::make_unique<AssetScene>(target, name, clip);
+    });
+    sceneManager.registerScene<BlankScene>("Menu");
+
+    sceneManager.changeScene("Level");
+    while (!resources.getLoadProgress().isDone()) resources.finishUploads(sf::milliseconds(2));
+    const SoundHandle sound = resources.getSoundHandle(StringId::hash("Level.sound"));
+    ASSERT_TRUE(sound.isValid());
+    EXPECT_EQ(resources.getMemoryUsage(sound), 22050 * sizeof(std::int16_t));
+    EXPECT_GT(sceneManager.getResidentMemory(), resources.getMemoryUsage(sound));
+
+    // The level's sound is most of the resident memory, so leaving it evicts it
+    sceneManager.setMemoryBudget(resources.getMemoryUsage(sound));
+    sceneManager.changeScene("Menu");
+    EXPECT_FALSE(sceneManager.isLoaded("Level"));
+    EXPECT_FALSE(resources.getSoundHandle(StringId::hash("Level.sound")).isValid());
+    EXPECT_EQ(resources.getMemoryUsage(sound), 0u);
+    std::filesystem::remove(clip);
+}
@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "Utility/FrameArena.hpp"
+
+TEST(frameArenaTest, alignsAndResets) {
+    FrameArena arena(256);
+    auto *byte = arena.create<char>('a');
+    auto *number = arena.create<double>(2.5);
+    EXPECT_EQ(*byte, 'a');
+    EXPECT_EQ(*number, 2.5);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(number) % alignof(double), 0u);
+    EXPECT_EQ(arena.getUsed(), 16u);
+
+    arena.reset();
+    EXPECT_EQ(arena.getUsed(), 0u);
+    EXPECT_EQ(arena.getHighWater(), 16u);
+    EXPECT_EQ(arena.create<char>('b'), byte);
+}
+
+TEST(frameArenaTest, overflowsToTheHeapForOneFrame) {
+    FrameArena arena(64);
+    std::pmr::vector<int> values(&arena);
+    for (int value = 0; value < 100; value++) values.push_back(value);
+    EXPECT_EQ(values[99], 99);
+    EXPECT_GT(arena.getOccupancy(), 1.f);
+
+    auto zeros = arena.createArray<int>(8);
+    EXPECT_EQ(zeros.size(), 8u);
+    EXPECT_EQ(zeros[7], 0);
+    values = std::pmr::vector<int>(&arena);
+    arena.reset();
+    EXPECT_EQ(arena.getOverflowFrames(), 1u);
+    EXPECT_GT(arena.getHighWater(), 64u);
+    EXPECT_NE(arena.create<int>(1), nullptr);
+    EXPECT_EQ(arena.getUsed(), sizeof(int));
+}
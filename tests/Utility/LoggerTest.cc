@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Utility/logger.hpp"
+
+namespace {
+/// Starts a file-only async logger in the temp directory.
+std::filesystem::path startFileLogger(const char *name, std::size_t capacity, LogOverflowPolicy policy) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    AsyncLogConfig config;
+    config.capacity = capacity;
+    config.overflowPolicy = policy;
+    config.writeToConsole = false;
+    config.filePath = path.string();
+    Logger::startAsync(config);
+    return path;
+}
+
+/// Reads the log lines, minus the "[time] [LEVEL] " prefix.
+std::vector<std::string> readMessages(const std::filesystem::path &path) {
+    std::ifstream file(path);
+    std::vector<std::string> messages;
+    for (std::string line; std::getline(file, line);) {
+        std::size_t level = line.find("] [");
+        std::size_t start = line.find("] ", level + 3);
+        messages.push_back(start == std::string::npos ? line : line.substr(start + 2));
+    }
+    return messages;
+}
+}  // namespace
+
+TEST(loggerTest, blockPolicyKeepsEveryRecordInOrder) {
+    constexpr int RECORDS = 2000;
+    const auto path = startFileLogger("loggerTest.block", 2, LogOverflowPolicy::Block);
+    const std::uint64_t dropsBefore = Logger::getDroppedCount();
+    for (int index = 0; index < RECORDS; index++) Logger::logf(LogLevel::WARNING, "record {}", index);
+    Logger::stopAsync();
+
+    EXPECT_EQ(Logger::getDroppedCount(), dropsBefore);
+    const auto messages = readMessages(path);
+    ASSERT_EQ(messages.size(), static_cast<std::size_t>(RECORDS));
+    for (int index = 0; index < RECORDS; index++) EXPECT_EQ(messages[index], "record " + std::to_string(index));
+    std::filesystem::remove(path);
+}
+
+TEST(loggerTest, dropPolicyCountsWhatItDiscards) {
+    constexpr int RECORDS = 20000;
+    const auto path = startFileLogger("loggerTest.drop", 2, LogOverflowPolicy::Drop);
+    const std::uint64_t dropsBefore = Logger::getDroppedCount();
+    for (int index = 0; index < RECORDS; index++) Logger::warning("flood");
+    Logger::stopAsync();
+
+    // A two-slot buffer cannot keep up; every record is either written or counted
+    const std::uint64_t dropped = Logger::getDroppedCount() - dropsBefore;
+    EXPECT_GT(dropped, 0u);
+    std::size_t written = 0, notices = 0;
+    for (const std::string &message : readMessages(path)) {
+        if (message == "flood")
+            written++;
+        else if (message.find("log records dropped") != std::string::npos)
+            notices++;
+    }
+    EXPECT_EQ(written + dropped, static_cast<std::uint64_t>(RECORDS));
+    EXPECT_GT(notices, 0u);
+    std::filesystem::remove(path);
+}
+
+TEST(loggerTest, longMessagesAreTruncated) {
+    const auto path = startFileLogger("loggerTest.long", 16, LogOverflowPolicy::Block);
+    Logger::info(std::string(1000, 'x'));
+    Logger::info("short");
+    Logger::stopAsync();
+
+    const auto messages = readMessages(path);
+    ASSERT_EQ(messages.size(), 2u);
+    EXPECT_LT(messages[0].size(), 1000u);
+    EXPECT_EQ(messages[0].find_first_not_of('x'), messages[0].size() - 3);
+    EXPECT_TRUE(messages[0].ends_with("..."));
+    EXPECT_EQ(messages[1], "short");
+    std::filesystem::remove(path);
+}
+
+TEST(loggerTest, stopWhileOtherThreadsLog) {
+    const auto path = startFileLogger("loggerTest.stop", 4, LogOverflowPolicy::Block);
+    std::atomic<bool> stopped{false};
+    std::vector<std::thread> loggers;
+    for (int thread = 0; thread < 4; thread++)
+        loggers.emplace_back([&stopped]() {
+            // Keeps logging across the stop; calls after it go to the console
+            while (!stopped.load()) Logger::info("busy");
+        });
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    Logger::stopAsync();
+    stopped.store(true);
+    for (std::thread &logger : loggers) logger.join();
+    EXPECT_FALSE(readMessages(path).empty());
+    std::filesystem::remove(path);
+}
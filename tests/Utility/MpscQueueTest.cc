@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Utility/MpscQueue.hpp"
+
+TEST(mpscQueueTest, fullQueueRejectsWithoutTakingTheValue) {
+    MpscQueue<std::unique_ptr<int>> queue(3);
+    EXPECT_EQ(queue.capacity(), 4u);
+    for (int value = 0; value < 4; value++) EXPECT_TRUE(queue.tryPush(std::make_unique<int>(value)));
+    auto extra = std::make_unique<int>(4);
+    EXPECT_FALSE(queue.tryPush(std::move(extra)));
+    ASSERT_NE(extra, nullptr);
+
+    std::unique_ptr<int> popped;
+    for (int value = 0; value < 4; value++) {
+        ASSERT_TRUE(queue.tryPop(popped));
+        EXPECT_EQ(*popped, value);
+    }
+    EXPECT_FALSE(queue.tryPop(popped));
+    // Wrapping around reuses the cells
+    EXPECT_TRUE(queue.tryPush(std::move(extra)));
+    ASSERT_TRUE(queue.tryPop(popped));
+    EXPECT_EQ(*popped, 4);
+}
+
+TEST(mpscQueueTest, keepsEachProducersOrder) {
+    constexpr int PRODUCERS = 4;
+    constexpr int PUSHES = 20000;
+    MpscQueue<std::pair<int, int>> queue(64);
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < PRODUCERS; producer++)
+        producers.emplace_back([&queue, producer]() {
+            for (int sequence = 0; sequence < PUSHES; sequence++)
+                while (!queue.tryPush({producer, sequence})) std::this_thread::yield();
+        });
+
+    // Producers interleave, but each one's elements arrive in push order
+    std::vector<int> next(PRODUCERS, 0);
+    std::pair<int, int> element;
+    for (int received = 0; received < PRODUCERS * PUSHES;) {
+        if (!queue.tryPop(element)) continue;
+        ASSERT_EQ(element.second, next[element.first]);
+        next[element.first]++;
+        received++;
+    }
+    for (std::thread &producer : producers) producer.join();
+    EXPECT_FALSE(queue.tryPop(element));
+    for (int count : next) EXPECT_EQ(count, PUSHES);
+}
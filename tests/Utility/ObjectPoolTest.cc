@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Utility/ObjectPool.hpp"
+
+namespace {
+struct Tracked {
+    static inline int alive = 0;
+    int value;
+    explicit Tracked(int value) : value(value) { alive++; }
+    ~Tracked() { alive--; }
+};
+}  // namespace
+
+TEST(objectPoolTest, handlesGoStaleWhenSlotsAreReused) {
+    ObjectPool<Tracked> pool(2);
+    auto first = pool.create(1);
+    ASSERT_NE(pool.get(first), nullptr);
+    EXPECT_EQ(pool.get(first)->value, 1);
+    EXPECT_TRUE(pool.destroy(first));
+    EXPECT_FALSE(pool.destroy(first));
+
+    auto second = pool.create(2);
+    EXPECT_EQ(second.index, first.index);
+    EXPECT_EQ(pool.get(first), nullptr);
+    EXPECT_EQ(pool.get(second)->value, 2);
+    EXPECT_EQ(pool.get({}), nullptr);
+}
+
+TEST(objectPoolTest, refusesToGrowAndTracksHighWater) {
+    {
+        ObjectPool<Tracked> pool(3);
+        std::vector<PoolHandle<Tracked>> handles;
+        for (int index = 0; index < 4; index++) handles.push_back(pool.create(index));
+        EXPECT_FALSE(handles[3].isValid());
+        EXPECT_EQ(pool.getFailedCreates(), 1u);
+        EXPECT_FLOAT_EQ(pool.getOccupancy(), 1.f);
+
+        pool.destroy(handles[0]);
+        pool.destroy(handles[1]);
+        EXPECT_EQ(pool.size(), 1u);
+        EXPECT_EQ(pool.getHighWater(), 3u);
+        EXPECT_EQ(Tracked::alive, 1);
+
+        int visited = 0;
+        pool.forEach([&](PoolHandle<Tracked> handle, Tracked &object) {
+            EXPECT_EQ(handle, handles[2]);
+            EXPECT_EQ(object.value, 2);
+            visited++;
+        });
+        EXPECT_EQ(visited, 1);
+    }
+    EXPECT_EQ(Tracked::alive, 0);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <optional>
+#include <thread>
+
+#include "Utility/Profiler.hpp"
+
+namespace {
+constexpr std::int64_t MILLISECOND = 1'000'000;
+
+/// Finds a zone in the summary; names are unique per test as the profiler is global.
+std::optional<PhaseSummary> findPhase(const char *name) {
+    for (const PhaseSummary &summary : Profiler::getSummary())
+        if (std::strcmp(summary.name, name) == 0) return summary;
+    return std::nullopt;
+}
+}  // namespace
+
+TEST(profilerTest, nestedZonesAreTimedSeparately) {
+    {
+        ProfileZone outer("profilerTest.outer");
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        {
+            ProfileZone inner("profilerTest.inner");
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+    Profiler::endFrame();
+
+    auto outer = findPhase("profilerTest.outer");
+    auto inner = findPhase("profilerTest.inner");
+    ASSERT_TRUE(outer.has_value());
+    ASSERT_TRUE(inner.has_value());
+    EXPECT_EQ(outer->samples, 1u);
+    EXPECT_EQ(inner->samples, 1u);
+    EXPECT_GE(inner->maxMs, 2.0);
+    EXPECT_GE(outer->maxMs, inner->maxMs + 2.0);
+}
+
+TEST(profilerTest, historyMergesNamesByContent) {
+    // Equal names at different addresses, as literals from two translation units can be
+    static const char first[] = "profilerTest.merged";
+    static const char second[] = "profilerTest.merged";
+    ASSERT_NE(static_cast<const void *>(first), static_cast<const void *>(second));
+    Profiler::record(first, 0, MILLISECOND);
+    Profiler::record(second, 0, 2 * MILLISECOND);
+    Profiler::endFrame();
+
+    std::size_t matches = 0;
+    for (const PhaseSummary &summary : Profiler::getSummary())
+        if (std::strcmp(summary.name, first) == 0) matches++;
+    EXPECT_EQ(matches, 1u);
+    auto merged = findPhase(first);
+    ASSERT_TRUE(merged.has_value());
+    EXPECT_DOUBLE_EQ(merged->p50Ms, 3.0);
+}
+
+TEST(profilerTest, historyKeepsTheLastWindowOfFrames) {
+    constexpr std::size_t FRAMES = Profiler::SUMMARY_WINDOW + 10;
+    for (std::size_t frame = 1; frame <= FRAMES; frame++) {
+        Profiler::record("profilerTest.window", 0, static_cast<std::int64_t>(frame) * MILLISECOND);
+        Profiler::endFrame();
+    }
+    // Frames without the zone leave its history alone
+    Profiler::endFrame();
+
+    auto window = findPhase("profilerTest.window");
+    ASSERT_TRUE(window.has_value());
+    EXPECT_EQ(window->samples, Profiler::SUMMARY_WINDOW);
+    EXPECT_DOUBLE_EQ(window->maxMs, static_cast<double>(FRAMES));
+    // Frames 11..250 remain, so the median is their middle one
+    EXPECT_DOUBLE_EQ(window->p50Ms, 131.0);
+    EXPECT_GE(window->p99Ms, window->p50Ms);
+}
+
+TEST(profilerTest, summarizesZonesOfEveryThread) {
+    std::thread worker([]() {
+        Profiler::setThreadName("profilerTest worker");
+        Profiler::record("profilerTest.worker", 0, 4 * MILLISECOND);
+        Profiler::record("profilerTest.shared", 0, MILLISECOND);
+    });
+    worker.join();
+    Profiler::record("profilerTest.shared", 0, MILLISECOND);
+    Profiler::endFrame();
+
+    auto fromWorker = findPhase("profilerTest.worker");
+    ASSERT_TRUE(fromWorker.has_value());
+    EXPECT_DOUBLE_EQ(fromWorker->maxMs, 4.0);
+    // Both threads ran it in the same frame
+    auto shared = findPhase("profilerTest.shared");
+    ASSERT_TRUE(shared.has_value());
+    EXPECT_EQ(shared->samples, 1u);
+    EXPECT_DOUBLE_EQ(shared->maxMs, 2.0);
+}
+
+TEST(profilerTest, readsRingsWhileTheirThreadsLapThem) {
+    // Every zone lasts exactly 1 ms, so a torn read would show up as a fractional frame total
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> recorded{0};
+    std::thread recorder([&done, &recorded]() {
+        for (std::int64_t start = 0; !done.load(); start += 7) {
+            Profiler::record("profilerTest.lapped", start, start + MILLISECOND);
+            recorded.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    while (recorded.load(std::memory_order_relaxed) < 4 * Profiler::EVENTS_PER_THREAD) Profiler::endFrame();
+    done.store(true);
+    recorder.join();
+    Profiler::endFrame();
+
+    auto lapped = findPhase("profilerTest.lapped");
+    ASSERT_TRUE(lapped.has_value());
+    EXPECT_DOUBLE_EQ(lapped->maxMs, std::round(lapped->maxMs));
+    EXPECT_DOUBLE_EQ(lapped->p50Ms, std::round(lapped->p50Ms));
+}
@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Utility/RectPacker.hpp"
+
+namespace {
+bool overlaps(const sf::IntRect &a, const sf::IntRect &b) {
+    return a.position.x < b.position.x + b.size.x && b.position.x < a.position.x + a.size.x &&
+           a.position.y < b.position.y + b.size.y && b.position.y < a.position.y + a.size.y;
+}
+}  // namespace
+
+TEST(rectPackerTest, placesRectanglesWithoutOverlap) {
+    RectPacker packer({256, 256}, 1);
+    std::vector<sf::IntRect> placed;
+    for (int i = 0; i < 200; i++) {
+        auto rect = packer.insert({8 + (i * 7) % 25, 8 + (i * 13) % 19});
+        if (!rect) continue;
+        EXPECT_GE(rect->position.x, 0);
+        EXPECT_GE(rect->position.y, 0);
+        EXPECT_LE(rect->position.x + rect->size.x, 256);
+        EXPECT_LE(rect->position.y + rect->size.y, 256);
+        for (const sf::IntRect &other : placed) EXPECT_FALSE(overlaps(*rect, other));
+        placed.push_back(*rect);
+    }
+    EXPECT_GT(placed.size(), 50u);
+    EXPECT_GT(packer.getOccupancy(), 0.6f);
+}
+
+TEST(rectPackerTest, fillsTheBinExactly) {
+    RectPacker packer({64, 64});
+    for (int i = 0; i < 16; i++) ASSERT_TRUE(packer.insert({16, 16}).has_value());
+    EXPECT_FALSE(packer.insert({1, 1}).has_value());
+    EXPECT_FLOAT_EQ(packer.getOccupancy(), 1.f);
+    packer.clear();
+    EXPECT_TRUE(packer.insert({64, 64}).has_value());
+    EXPECT_FALSE(packer.insert({65, 1}).has_value());
+}
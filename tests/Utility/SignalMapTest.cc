@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+
+#include <SFML/Graphics.hpp>
+
+#include "Core/KeyboardState.hpp"
+#include "Core/MouseState.hpp"
+#include "Utility/SignalMap.hpp"
+
+TEST(signalMapTest, keyRoundTrip) {
+    for (int index = 1; index < static_cast<int>(Key::KeyCount); index++) {
+        Key key = static_cast<Key>(index);
+        EXPECT_EQ(SignalMap::mapSfmlKey(SignalMap::mapKeyToSfml(key)), key);
+        EXPECT_EQ(SignalMap::findKey(SignalMap::getKeyName(key)), key);
+    }
+}
+
+TEST(signalMapTest, unknownKey) {
+    EXPECT_EQ(SignalMap::mapSfmlKey(sf::Keyboard::Key::Unknown), Key::Unknown);
+    EXPECT_EQ(SignalMap::mapKeyToSfml(Key::Unknown), sf::Keyboard::Key::Unknown);
+    EXPECT_EQ(SignalMap::findKey("NotAKey"), Key::Unknown);
+}
+
+TEST(signalMapTest, mouseButtons) {
+    EXPECT_EQ(SignalMap::mapSfmlMouseButton(sf::Mouse::Button::Left), Mouse::Left);
+    EXPECT_EQ(SignalMap::mapSfmlMouseButton(sf::Mouse::Button::Right), Mouse::Right);
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Utility/SpatialHash.hpp"
+
+namespace {
+std::vector<std::uint32_t> sorted(std::vector<std::uint32_t> ids) {
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+}  // namespace
+
+TEST(spatialHashTest, radiusAndRect) {
+    SpatialHash hash(32.f);
+    hash.update(0, sf::Vector2f{10.f, 10.f});
+    hash.update(1, sf::Vector2f{50.f, 10.f});
+    hash.update(2, sf::Vector2f{-40.f, -40.f});
+    hash.insert(3, {{100.f, 100.f}, {80.f, 80.f}});
+
+    std::vector<std::uint32_t> result;
+    hash.queryRadius({0.f, 0.f}, 20.f, result);
+    EXPECT_EQ(sorted(result), (std::vector<std::uint32_t>{0}));
+    hash.queryRadius({0.f, 0.f}, 60.f, result);
+    EXPECT_EQ(sorted(result), (std::vector<std::uint32_t>{0, 1, 2}));
+    // The box spans several cells but is reported once.
+    hash.queryRect({{90.f, 90.f}, {200.f, 200.f}}, result);
+    EXPECT_EQ(result, (std::vector<std::uint32_t>{3}));
+
+    hash.update(0, sf::Vector2f{500.f, 500.f});
+    hash.remove(1);
+    hash.queryRadius({0.f, 0.f}, 60.f, result);
+    EXPECT_EQ(result, (std::vector<std::uint32_t>{2}));
+    EXPECT_EQ(hash.size(), 3u);
+
+    hash.setCellSize(7.f);
+    hash.queryRadius({0.f, 0.f}, 60.f, result);
+    EXPECT_EQ(result, (std::vector<std::uint32_t>{2}));
+    EXPECT_EQ(hash.size(), 3u);
+}
+
+TEST(spatialHashTest, nearestMatchesBruteForce) {
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> coordinate(-500.f, 500.f);
+    SpatialHash hash(40.f);
+    std::vector<sf::Vector2f> points;
+    for (std::uint32_t id = 0; id < 500; id++) {
+        points.push_back({coordinate(random), coordinate(random)});
+        hash.update(id, points.back());
+    }
+    std::vector<std::uint32_t> result;
+    for (int query = 0; query < 50; query++) {
+        sf::Vector2f center{coordinate(random), coordinate(random)};
+        hash.queryNearest(center, 5, 1e9f, result);
+        std::vector<std::uint32_t> expected(points.size());
+        for (std::uint32_t id = 0; id < points.size(); id++) expected[id] = id;
+        auto distance = [&](std::uint32_t id) {
+            sf::Vector2f offset = points[id] - center;
+            return offset.x * offset.x + offset.y * offset.y;
+        };
+        std::sort(expected.begin(), expected.end(), [&](std::uint32_t left, std::uint32_t right) {
+            return distance(left) < distance(right);
+        });
+        expected.resize(5);
+        EXPECT_EQ(result, expected);
+    }
+    std::vector<std::uint32_t> inRadius;
+    hash.queryRadius({0.f, 0.f}, 100.f, inRadius);
+    hash.queryNearest({0.f, 0.f}, points.size(), 100.f, result);
+    EXPECT_EQ(sorted(result), sorted(inRadius));
+}
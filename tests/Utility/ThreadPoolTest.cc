@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "Utility/ThreadPool.hpp"
+
+TEST(threadPoolTest, returnsResults) {
+    ThreadPool pool(4);
+    std::vector<std::future<int>> results;
+    for (int index = 0; index < 100; index++)
+        results.push_back(pool.submit([index]() { return index * index; }));
+    for (int index = 0; index < 100; index++) EXPECT_EQ(results[index].get(), index * index);
+}
+
+TEST(threadPoolTest, forwardsExceptions) {
+    ThreadPool pool(1);
+    auto result = pool.submit([]() -> int { throw std::runtime_error("decode failed"); });
+    EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+TEST(threadPoolTest, runsEveryTask) {
+    std::atomic<int> counter{0};
+    {
+        ThreadPool pool(3);
+        std::vector<std::future<void>> results;
+        for (int index = 0; index < 1000; index++)
+            results.push_back(pool.submit([&counter]() { counter++; }));
+        for (auto &result : results) result.wait();
+    }
+    EXPECT_EQ(counter.load(), 1000);
+}
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "Utility/TripleBuffer.hpp"
+
+TEST(tripleBufferTest, readerSeesOnlyTheLatestPublish) {
+    TripleBuffer<int> buffer;
+    EXPECT_FALSE(buffer.update());
+    buffer.getWriteBuffer() = 1;
+    buffer.publish();
+    buffer.getWriteBuffer() = 2;
+    buffer.publish();
+    EXPECT_TRUE(buffer.update());
+    EXPECT_EQ(buffer.getReadBuffer(), 2);
+    EXPECT_FALSE(buffer.update());
+    EXPECT_EQ(buffer.getReadBuffer(), 2);
+}
+
+TEST(tripleBufferTest, readerNeverSeesAHalfWrittenBuffer) {
+    constexpr int PUBLISHES = 20000;
+    TripleBuffer<std::vector<int>> buffer;
+    std::thread writer([&]() {
+        for (int value = 1; value <= PUBLISHES; value++) {
+            std::vector<int> &values = buffer.getWriteBuffer();
+            values.assign(16, value);
+            buffer.publish();
+        }
+    });
+    // The last publish always reaches the reader, however many it skips
+    int last = 0;
+    while (last < PUBLISHES) {
+        if (!buffer.update()) continue;
+        const std::vector<int> &values = buffer.getReadBuffer();
+        ASSERT_EQ(values.size(), 16u);
+        for (int value : values) ASSERT_EQ(value, values.front());
+        ASSERT_GT(values.front(), last);
+        last = values.front();
+    }
+    writer.join();
+    EXPECT_EQ(buffer.getReadBuffer().front(), PUBLISHES);
+}
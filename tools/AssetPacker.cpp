@@ -0,0 +1,61 @@
+// Packs every file under a directory into an AssetPack archive that
+// ResourceManager::mountPack() serves assets from.
+//
+// Usage: AssetPacker <input directory> <output .pack>
+//
+// Files are named after their path relative to the input directory's parent,
+// with '/' separators, so packing "assets" yields names like
+// "assets/sounds/pickupCoin.wav": the same paths the game loads loose files by.
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "Core/AssetPack.hpp"
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        std::fprintf(stderr, "Usage: AssetPacker <input directory> <output .pack>\n");
+        return 2;
+    }
+    const std::filesystem::path inputDirectory = std::filesystem::path(argv[1]).lexically_normal();
+    const std::filesystem::path packPath = argv[2];
+    const std::filesystem::path root =
+        (inputDirectory.has_filename() ? inputDirectory : inputDirectory.parent_path()).parent_path();
+
+    std::error_code error;
+    std::vector<AssetPack::Source> sources;
+    std::size_t totalBytes = 0;
+    for (const auto &entry : std::filesystem::recursive_directory_iterator(inputDirectory, error)) {
+        if (!entry.is_regular_file()) continue;
+        std::ifstream input(entry.path(), std::ios::binary);
+        std::vector<char> bytes{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+        if (!input.good() && !input.eof()) {
+            std::fprintf(stderr, "Cannot read file: %s\n", entry.path().string().c_str());
+            return 1;
+        }
+        AssetPack::Source source;
+        source.name = entry.path().lexically_relative(root).generic_string();
+        source.data.resize(bytes.size());
+        std::memcpy(source.data.data(), bytes.data(), bytes.size());
+        totalBytes += bytes.size();
+        sources.push_back(std::move(source));
+    }
+    if (error) {
+        std::fprintf(stderr, "Cannot read directory: %s\n", inputDirectory.string().c_str());
+        return 1;
+    }
+
+    if (packPath.has_parent_path()) std::filesystem::create_directories(packPath.parent_path(), error);
+    const std::size_t fileCount = sources.size();
+    std::ofstream output(packPath, std::ios::binary);
+    if (!output || !AssetPack::write(output, std::move(sources))) {
+        std::fprintf(stderr, "Cannot write pack (or two names collide): %s\n", packPath.string().c_str());
+        return 1;
+    }
+    std::printf("{\"files\": %zu, \"bytes\": %zu}\n", fileCount, totalBytes);
+    return 0;
+}
@@ -0,0 +1,140 @@
+// Packs a directory of sprite images into texture atlas pages and a manifest
+// that ResourceManager::loadAtlas() reads.
+//
+// Usage: AtlasPacker <input directory> <output .atlas> [--size 2048] [--padding 1] [--pages N]
+//
+// Sprites are named after their path relative to the input directory, without
+// extension and with '/' separators, e.g. "enemies/slime". Pages are written
+// next to the manifest as <name>_<page>.png. --pages makes packing fail unless
+// exactly N pages come out, so a build system can list every file it produces.
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+#include "Core/AtlasManifest.hpp"
+#include "Utility/RectPacker.hpp"
+
+namespace {
+struct SourceImage {
+    std::string name;
+    sf::Image image;
+};
+
+bool isImage(const std::filesystem::path &path) {
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".png" || extension == ".bmp" || extension == ".tga" || extension == ".jpg";
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        std::fprintf(stderr, "Usage: AtlasPacker <input directory> <output .atlas> [--size N] [--padding N] [--pages N]\n");
+        return 2;
+    }
+    const std::filesystem::path inputDirectory = argv[1];
+    const std::filesystem::path manifestPath = argv[2];
+    int pageSize = 2048;
+    int padding = 1;
+    int expectedPages = -1;
+    for (int index = 3; index < argc; index++) {
+        std::string argument = argv[index];
+        bool hasValue = index + 1 < argc;
+        if (argument == "--size" && hasValue)
+            pageSize = std::atoi(argv[++index]);
+        else if (argument == "--padding" && hasValue)
+            padding = std::atoi(argv[++index]);
+        else if (argument == "--pages" && hasValue)
+            expectedPages = std::atoi(argv[++index]);
+        else {
+            std::fprintf(stderr, "Unknown argument: %s\n", argument.c_str());
+            return 2;
+        }
+    }
+
+    std::error_code error;
+    std::vector<SourceImage> sources;
+    for (const auto &entry : std::filesystem::recursive_directory_iterator(inputDirectory, error)) {
+        if (!entry.is_regular_file() || !isImage(entry.path())) continue;
+        SourceImage source;
+        source.name = entry.path().lexically_relative(inputDirectory).replace_extension().generic_string();
+        if (!source.image.loadFromFile(entry.path())) {
+            std::fprintf(stderr, "Cannot load image: %s\n", entry.path().string().c_str());
+            return 1;
+        }
+        sources.push_back(std::move(source));
+    }
+    if (error) {
+        std::fprintf(stderr, "Cannot read directory: %s\n", inputDirectory.string().c_str());
+        return 1;
+    }
+
+    // Largest first packs tightest; the name breaks ties so output is reproducible
+    std::sort(sources.begin(), sources.end(), [](const SourceImage &a, const SourceImage &b) {
+        const sf::Vector2u sizeA = a.image.getSize(), sizeB = b.image.getSize();
+        const unsigned sideA = std::max(sizeA.x, sizeA.y), sideB = std::max(sizeB.x, sizeB.y);
+        if (sideA != sideB) return sideA > sideB;
+        if (sizeA.x * sizeA.y != sizeB.x * sizeB.y) return sizeA.x * sizeA.y > sizeB.x * sizeB.y;
+        return a.name < b.name;
+    });
+
+    AtlasManifest manifest;
+    std::vector<RectPacker> packers;
+    std::vector<sf::Image> pages;
+    for (const SourceImage &source : sources) {
+        const sf::Vector2i size(source.image.getSize());
+        std::optional<sf::IntRect> placed;
+        std::size_t page = 0;
+        for (; page < packers.size() && !placed; page++) placed = packers[page].insert(size);
+        if (!placed) {
+            packers.emplace_back(sf::Vector2i{pageSize, pageSize}, padding);
+            pages.emplace_back(sf::Vector2u(pageSize, pageSize), sf::Color::Transparent);
+            placed = packers.back().insert(size);
+            page = packers.size();
+            if (!placed) {
+                std::fprintf(stderr, "Sprite larger than a page: %s\n", source.name.c_str());
+                return 1;
+            }
+        }
+        page--;
+        if (!pages[page].copy(source.image, sf::Vector2u(placed->position))) {
+            std::fprintf(stderr, "Cannot copy sprite: %s\n", source.name.c_str());
+            return 1;
+        }
+        manifest.sprites.push_back({source.name, static_cast<std::uint16_t>(page), *placed});
+    }
+
+    if (expectedPages >= 0 && pages.size() != static_cast<std::size_t>(expectedPages)) {
+        std::fprintf(stderr, "Sprites fill %zu pages, expected %d\n", pages.size(), expectedPages);
+        return 1;
+    }
+    if (manifestPath.has_parent_path()) std::filesystem::create_directories(manifestPath.parent_path(), error);
+    const std::string stem = manifestPath.stem().string();
+    for (std::size_t page = 0; page < pages.size(); page++) {
+        const std::string fileName = stem + "_" + std::to_string(page) + ".png";
+        if (!pages[page].saveToFile(manifestPath.parent_path() / fileName)) {
+            std::fprintf(stderr, "Cannot write page: %s\n", fileName.c_str());
+            return 1;
+        }
+        manifest.pages.push_back(fileName);
+    }
+
+    std::ofstream file(manifestPath, std::ios::binary);
+    if (!file || !manifest.write(file)) {
+        std::fprintf(stderr, "Cannot write manifest: %s\n", manifestPath.string().c_str());
+        return 1;
+    }
+    for (std::size_t page = 0; page < packers.size(); page++)
+        std::printf("{\"page\": %zu, \"occupancy\": %.3f}\n", page, packers[page].getOccupancy());
+    std::printf("{\"sprites\": %zu, \"pages\": %zu}\n", manifest.sprites.size(), pages.size());
+    return 0;
+}